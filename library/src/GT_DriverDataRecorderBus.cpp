@@ -6,11 +6,12 @@
 #endif
 
 
-void GT_DriverDataRecorderBusInitialize(const uint8_t* idCharacters, uint32_t numIDCharacters, uint32_t numSamplesPerFile, uint32_t numBytesPerSample, const uint8_t* signalNames, uint32_t strlenSignalNames, const uint8_t* dimensions, uint32_t strlenDimensions, const uint8_t* dataTypes, uint32_t strlenDataTypes){
+void GT_DriverDataRecorderBusInitialize(int32_t* handle, const uint8_t* idCharacters, uint32_t numIDCharacters, uint32_t numSamplesPerFile, uint32_t numBytesPerSample, const uint8_t* signalNames, uint32_t strlenSignalNames, const uint8_t* dimensions, uint32_t strlenDimensions, const uint8_t* dataTypes, uint32_t strlenDataTypes){
     #ifdef GENERIC_TARGET_IMPLEMENTATION
-    gt::GenericTarget::dataRecorderManager.RegisterBus(idCharacters, numIDCharacters, numSamplesPerFile, numBytesPerSample, signalNames, strlenSignalNames, dimensions, strlenDimensions, dataTypes, strlenDataTypes);
+    *handle = gt::GenericTarget::dataRecorderManager.RegisterBus(idCharacters, numIDCharacters, numSamplesPerFile, numBytesPerSample, signalNames, strlenSignalNames, dimensions, strlenDimensions, dataTypes, strlenDataTypes);
     #elif defined(GENERIC_TARGET_SIMULINK_SUPPORT)
     gt_simulink_support::GenericTarget::ResetStartTimepoint();
+    *handle = -1;
     (void)idCharacters;
     (void)numIDCharacters;
     (void)numSamplesPerFile;
@@ -22,6 +23,7 @@ void GT_DriverDataRecorderBusInitialize(const uint8_t* idCharacters, uint32_t nu
     (void)dataTypes;
     (void)strlenDataTypes;
     #else
+    *handle = -1;
     (void)idCharacters;
     (void)numIDCharacters;
     (void)numSamplesPerFile;
@@ -37,12 +39,11 @@ void GT_DriverDataRecorderBusInitialize(const uint8_t* idCharacters, uint32_t nu
 
 void GT_DriverDataRecorderBusTerminate(void){}
 
-void GT_DriverDataRecorderBusStep(const uint8_t* idCharacters, uint32_t numIDCharacters, double timestamp, uint8_t* bytes, uint32_t numBytesPerSample){
+void GT_DriverDataRecorderBusStep(const int32_t* handle, double timestamp, uint8_t* bytes, uint32_t numBytesPerSample){
     #ifdef GENERIC_TARGET_IMPLEMENTATION
-    gt::GenericTarget::dataRecorderManager.WriteBus(idCharacters, numIDCharacters, timestamp, bytes, numBytesPerSample);
+    gt::GenericTarget::dataRecorderManager.WriteBus(*handle, timestamp, bytes, numBytesPerSample);
     #else
-    (void)idCharacters;
-    (void)numIDCharacters;
+    (void)handle;
     (void)timestamp;
     (void)bytes;
     (void)numBytesPerSample;
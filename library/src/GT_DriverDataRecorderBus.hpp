@@ -6,6 +6,7 @@
 
 /**
  * @brief Initialize the driver.
+ * @param [out] handle The handle of the data recorder, which is stored in the work vector of the block (negative if the data recorder could not be registered).
  * @param [in] idCharacters Characters representing the unique ID of the data record.
  * @param [in] numIDCharacters Actual number of characters representing the unique ID.
  * @param [in] numSamplesPerFile The number of samples per file or zero if all samples should be written to one file.
@@ -17,7 +18,7 @@
  * @param [in] dataTypes String representing all signal data types separated by comma.
  * @param [in] strlenDataTypes Number of characters in the dataTypes array.
  */
-extern void GT_DriverDataRecorderBusInitialize(const uint8_t* idCharacters, uint32_t numIDCharacters, uint32_t numSamplesPerFile, uint32_t numBytesPerSample, const uint8_t* signalNames, uint32_t strlenSignalNames, const uint8_t* dimensions, uint32_t strlenDimensions, const uint8_t* dataTypes, uint32_t strlenDataTypes);
+extern void GT_DriverDataRecorderBusInitialize(int32_t* handle, const uint8_t* idCharacters, uint32_t numIDCharacters, uint32_t numSamplesPerFile, uint32_t numBytesPerSample, const uint8_t* signalNames, uint32_t strlenSignalNames, const uint8_t* dimensions, uint32_t strlenDimensions, const uint8_t* dataTypes, uint32_t strlenDataTypes);
 
 /**
  * @brief Terminate the driver.
@@ -26,11 +27,10 @@ extern void GT_DriverDataRecorderBusTerminate(void);
 
 /**
  * @brief Perform one step of the driver.
- * @param [in] idCharacters Characters representing the unique ID of the data record.
- * @param [in] numIDCharacters Actual number of characters representing the unique ID.
+ * @param [in] handle The handle of the data recorder that has been set during initialization.
  * @param [in] timestamp A time value associated with the data value.
  * @param [in] bytes Array containing the bytes for a sample (exluding timestamp).
  * @param [in] numBytesPerSample The number of bytes per sample (exluding timestamp).
  */
-extern void GT_DriverDataRecorderBusStep(const uint8_t* idCharacters, uint32_t numIDCharacters, double timestamp, uint8_t* bytes, uint32_t numBytesPerSample);
+extern void GT_DriverDataRecorderBusStep(const int32_t* handle, double timestamp, uint8_t* bytes, uint32_t numBytesPerSample);
 
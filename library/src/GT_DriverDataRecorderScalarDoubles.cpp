@@ -6,11 +6,12 @@
 #endif
 
 
-void GT_DriverDataRecorderScalarDoublesInitialize(const uint8_t* idCharacters, uint32_t numIDCharacters, const uint8_t* signalNames, uint32_t numCharacters, uint32_t numSignals, uint32_t numSamplesPerFile){
+void GT_DriverDataRecorderScalarDoublesInitialize(int32_t* handle, const uint8_t* idCharacters, uint32_t numIDCharacters, const uint8_t* signalNames, uint32_t numCharacters, uint32_t numSignals, uint32_t numSamplesPerFile){
     #ifdef GENERIC_TARGET_IMPLEMENTATION
-    gt::GenericTarget::dataRecorderManager.RegisterScalarDoubles(idCharacters, numIDCharacters, signalNames, numCharacters, numSignals, numSamplesPerFile);
+    *handle = gt::GenericTarget::dataRecorderManager.RegisterScalarDoubles(idCharacters, numIDCharacters, signalNames, numCharacters, numSignals, numSamplesPerFile);
     #elif defined(GENERIC_TARGET_SIMULINK_SUPPORT)
     gt_simulink_support::GenericTarget::ResetStartTimepoint();
+    *handle = -1;
     (void)idCharacters;
     (void)numIDCharacters;
     (void)signalNames;
@@ -18,6 +19,7 @@ void GT_DriverDataRecorderScalarDoublesInitialize(const uint8_t* idCharacters, u
     (void)numSignals;
     (void)numSamplesPerFile;
     #else
+    *handle = -1;
     (void)idCharacters;
     (void)numIDCharacters;
     (void)signalNames;
@@ -29,12 +31,11 @@ void GT_DriverDataRecorderScalarDoublesInitialize(const uint8_t* idCharacters, u
 
 void GT_DriverDataRecorderScalarDoublesTerminate(void){}
 
-void GT_DriverDataRecorderScalarDoublesStep(const uint8_t* idCharacters, uint32_t numIDCharacters, double timestamp, double* values, uint32_t numValues){
+void GT_DriverDataRecorderScalarDoublesStep(const int32_t* handle, double timestamp, double* values, uint32_t numValues){
     #ifdef GENERIC_TARGET_IMPLEMENTATION
-    gt::GenericTarget::dataRecorderManager.WriteScalarDoubles(idCharacters, numIDCharacters, timestamp, values, numValues);
+    gt::GenericTarget::dataRecorderManager.WriteScalarDoubles(*handle, timestamp, values, numValues);
     #else
-    (void)idCharacters;
-    (void)numIDCharacters;
+    (void)handle;
     (void)timestamp;
     (void)values;
     (void)numValues;
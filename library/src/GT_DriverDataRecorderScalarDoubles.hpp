@@ -6,6 +6,7 @@
 
 /**
  * @brief Initialize the driver.
+ * @param [out] handle The handle of the data recorder, which is stored in the work vector of the block (negative if the data recorder could not be registered).
  * @param [in] idCharacters Characters representing the unique ID of the data record.
  * @param [in] numIDCharacters Actual number of characters representing the unique ID.
  * @param [in] signalNames Names for all signals separated by comma.
@@ -13,7 +14,7 @@
  * @param [in] numSignals Number of signals to record.
  * @param [in] numSamplesPerFile The number of samples per file or zero if all samples should be written to one file.
  */
-extern void GT_DriverDataRecorderScalarDoublesInitialize(const uint8_t* idCharacters, uint32_t numIDCharacters, const uint8_t* signalNames, uint32_t numCharacters, uint32_t numSignals, uint32_t numSamplesPerFile);
+extern void GT_DriverDataRecorderScalarDoublesInitialize(int32_t* handle, const uint8_t* idCharacters, uint32_t numIDCharacters, const uint8_t* signalNames, uint32_t numCharacters, uint32_t numSignals, uint32_t numSamplesPerFile);
 
 /**
  * @brief Terminate the driver
@@ -22,11 +23,10 @@ extern void GT_DriverDataRecorderScalarDoublesTerminate(void);
 
 /**
  * @brief Perform one step of the driver.
- * @param [in] idCharacters Characters representing the unique ID of the data record.
- * @param [in] numIDCharacters Actual number of characters representing the unique ID.
+ * @param [in] handle The handle of the data recorder that has been set during initialization.
  * @param [in] timestamp A time value associated with the data value.
  * @param [in] values Signal values.
  * @param [in] numValues Number of values.
  */
-extern void GT_DriverDataRecorderScalarDoublesStep(const uint8_t* idCharacters, uint32_t numIDCharacters, double timestamp, double* values, uint32_t numValues);
+extern void GT_DriverDataRecorderScalarDoublesStep(const int32_t* handle, double timestamp, double* values, uint32_t numValues);
 
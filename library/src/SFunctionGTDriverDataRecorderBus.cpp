@@ -5,7 +5,7 @@
  *      The purpose of this sfunction is to call a simple legacy
  *      function during simulation:
  *
- *         void GT_DriverDataRecorderBusStep(uint8 p1[], uint32 p2, double u1, uint8 u2[p4], uint32 p4)
+ *         void GT_DriverDataRecorderBusStep(int32 work1[1], double u1, uint8 u2[p4], uint32 p4)
  *
  *    Simulink version           : 23.2 (R2023b) 01-Aug-2023
  *    C++ source code generated on : 10-Apr-2024 10:38:30
@@ -17,8 +17,8 @@
      %%%-MATLAB_Construction_Commands_Start
      def = legacy_code('initialize');
      def.SFunctionName = 'SFunctionGTDriverDataRecorderBus';
-     def.OutputFcnSpec = 'void GT_DriverDataRecorderBusStep(uint8 p1[], uint32 p2, double u1, uint8 u2[p4], uint32 p4)';
-     def.StartFcnSpec = 'void GT_DriverDataRecorderBusInitialize(uint8 p1[], uint32 p2, uint32 p3, uint32 p4, uint8 p5[], uint32 p6, uint8 p7[], uint32 p8, uint8 p9[], uint32 p10)';
+     def.OutputFcnSpec = 'void GT_DriverDataRecorderBusStep(int32 work1[1], double u1, uint8 u2[p4], uint32 p4)';
+     def.StartFcnSpec = 'void GT_DriverDataRecorderBusInitialize(int32 work1[1], uint8 p1[], uint32 p2, uint32 p3, uint32 p4, uint8 p5[], uint32 p6, uint8 p7[], uint32 p8, uint8 p9[], uint32 p10)';
      def.TerminateFcnSpec = 'void GT_DriverDataRecorderBusTerminate()';
      def.HeaderFiles = {'GT_DriverDataRecorderBus.hpp'};
      def.SourceFiles = {'GT_DriverDataRecorderBus.cpp', 'GT_SimulinkSupport.cpp'};
@@ -276,9 +276,16 @@ static void mdlInitializeSizes(SimStruct *S)
     ssSetSFcnParamTunable(S, 10, 0);
 
     /* Set the number of work vectors */
-    if (!ssSetNumDWork(S, 0)) return;
+    if (!ssSetNumDWork(S, 1)) return;
     ssSetNumPWork(S, 0);
 
+    /* Configure the dwork 1 (work1) */
+    ssSetDWorkDataType(S, 0, SS_INT32);
+    ssSetDWorkUsageType(S, 0, SS_DWORK_USED_AS_DWORK);
+    ssSetDWorkName(S, 0, "work1");
+    ssSetDWorkWidth(S, 0, 1);
+    ssSetDWorkComplexSignal(S, 0, COMPLEX_NO);
+
     /* Set the number of input ports */
     if (!ssSetNumInputPorts(S, 2)) return;
 
@@ -456,6 +463,7 @@ static void mdlStart(SimStruct *S)
 {
 
     /* Get access to Parameter/Input/Output/DWork data */
+    int32_T* work1 = (int32_T*) ssGetDWork(S, 0);
     uint8_T* p1 = (uint8_T*) ssGetRunTimeParamInfo(S, 0)->data;
     uint32_T* p2 = (uint32_T*) ssGetRunTimeParamInfo(S, 1)->data;
     uint32_T* p3 = (uint32_T*) ssGetRunTimeParamInfo(S, 2)->data;
@@ -469,7 +477,7 @@ static void mdlStart(SimStruct *S)
 
 
     /* Call the legacy code function */
-    GT_DriverDataRecorderBusInitialize(p1, *p2, *p3, *p4, p5, *p6, p7, *p8, p9, *p10);
+    GT_DriverDataRecorderBusInitialize(work1, p1, *p2, *p3, *p4, p5, *p6, p7, *p8, p9, *p10);
 }
 #endif
 
@@ -483,15 +491,14 @@ static void mdlOutputs(SimStruct *S, int_T tid)
 {
 
     /* Get access to Parameter/Input/Output/DWork data */
-    uint8_T* p1 = (uint8_T*) ssGetRunTimeParamInfo(S, 0)->data;
-    uint32_T* p2 = (uint32_T*) ssGetRunTimeParamInfo(S, 1)->data;
+    int32_T* work1 = (int32_T*) ssGetDWork(S, 0);
     real_T* u1 = (real_T*) ssGetInputPortSignal(S, 0);
     uint8_T* u2 = (uint8_T*) ssGetInputPortSignal(S, 1);
     uint32_T* p4 = (uint32_T*) ssGetRunTimeParamInfo(S, 3)->data;
 
 
     /* Call the legacy code function */
-    GT_DriverDataRecorderBusStep(p1, *p2, *u1, u2, *p4);
+    GT_DriverDataRecorderBusStep(work1, *u1, u2, *p4);
 }
 
 /* Function: mdlTerminate =================================================
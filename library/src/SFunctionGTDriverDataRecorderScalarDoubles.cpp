@@ -5,7 +5,7 @@
  *      The purpose of this sfunction is to call a simple legacy
  *      function during simulation:
  *
- *         void GT_DriverDataRecorderScalarDoublesStep(uint8 p1[], uint32 p2, double u1, double u2[], uint32 p5)
+ *         void GT_DriverDataRecorderScalarDoublesStep(int32 work1[1], double u1, double u2[], uint32 p5)
  *
  *    Simulink version           : 23.2 (R2023b) 01-Aug-2023
  *    C++ source code generated on : 10-Apr-2024 10:38:30
@@ -17,8 +17,8 @@
      %%%-MATLAB_Construction_Commands_Start
      def = legacy_code('initialize');
      def.SFunctionName = 'SFunctionGTDriverDataRecorderScalarDoubles';
-     def.OutputFcnSpec = 'void GT_DriverDataRecorderScalarDoublesStep(uint8 p1[], uint32 p2, double u1, double u2[], uint32 p5)';
-     def.StartFcnSpec = 'void GT_DriverDataRecorderScalarDoublesInitialize(uint8 p1[], uint32 p2, uint8 p3[], uint32 p4, uint32 p5, uint32 p6)';
+     def.OutputFcnSpec = 'void GT_DriverDataRecorderScalarDoublesStep(int32 work1[1], double u1, double u2[], uint32 p5)';
+     def.StartFcnSpec = 'void GT_DriverDataRecorderScalarDoublesInitialize(int32 work1[1], uint8 p1[], uint32 p2, uint8 p3[], uint32 p4, uint32 p5, uint32 p6)';
      def.TerminateFcnSpec = 'void GT_DriverDataRecorderScalarDoublesTerminate()';
      def.HeaderFiles = {'GT_DriverDataRecorderScalarDoubles.hpp'};
      def.SourceFiles = {'GT_DriverDataRecorderScalarDoubles.cpp', 'GT_SimulinkSupport.cpp'};
@@ -218,9 +218,16 @@ static void mdlInitializeSizes(SimStruct *S)
     ssSetSFcnParamTunable(S, 6, 0);
 
     /* Set the number of work vectors */
-    if (!ssSetNumDWork(S, 0)) return;
+    if (!ssSetNumDWork(S, 1)) return;
     ssSetNumPWork(S, 0);
 
+    /* Configure the dwork 1 (work1) */
+    ssSetDWorkDataType(S, 0, SS_INT32);
+    ssSetDWorkUsageType(S, 0, SS_DWORK_USED_AS_DWORK);
+    ssSetDWorkName(S, 0, "work1");
+    ssSetDWorkWidth(S, 0, 1);
+    ssSetDWorkComplexSignal(S, 0, COMPLEX_NO);
+
     /* Set the number of input ports */
     if (!ssSetNumInputPorts(S, 2)) return;
 
@@ -451,6 +458,7 @@ static void mdlStart(SimStruct *S)
 {
 
     /* Get access to Parameter/Input/Output/DWork data */
+    int32_T* work1 = (int32_T*) ssGetDWork(S, 0);
     uint8_T* p1 = (uint8_T*) ssGetRunTimeParamInfo(S, 0)->data;
     uint32_T* p2 = (uint32_T*) ssGetRunTimeParamInfo(S, 1)->data;
     uint8_T* p3 = (uint8_T*) ssGetRunTimeParamInfo(S, 2)->data;
@@ -460,7 +468,7 @@ static void mdlStart(SimStruct *S)
 
 
     /* Call the legacy code function */
-    GT_DriverDataRecorderScalarDoublesInitialize(p1, *p2, p3, *p4, *p5, *p6);
+    GT_DriverDataRecorderScalarDoublesInitialize(work1, p1, *p2, p3, *p4, *p5, *p6);
 }
 #endif
 
@@ -474,15 +482,14 @@ static void mdlOutputs(SimStruct *S, int_T tid)
 {
 
     /* Get access to Parameter/Input/Output/DWork data */
-    uint8_T* p1 = (uint8_T*) ssGetRunTimeParamInfo(S, 0)->data;
-    uint32_T* p2 = (uint32_T*) ssGetRunTimeParamInfo(S, 1)->data;
+    int32_T* work1 = (int32_T*) ssGetDWork(S, 0);
     real_T* u1 = (real_T*) ssGetInputPortSignal(S, 0);
     real_T* u2 = (real_T*) ssGetInputPortSignal(S, 1);
     uint32_T* p5 = (uint32_T*) ssGetRunTimeParamInfo(S, 4)->data;
 
 
     /* Call the legacy code function */
-    GT_DriverDataRecorderScalarDoublesStep(p1, *p2, *u1, u2, *p5);
+    GT_DriverDataRecorderScalarDoublesStep(work1, *u1, u2, *p5);
 }
 
 /* Function: mdlTerminate =================================================
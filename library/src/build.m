@@ -179,9 +179,9 @@ defs = [defs; def];
 % ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 def = legacy_code('initialize');
 def.SFunctionName = 'SFunctionGTDriverDataRecorderScalarDoubles';
-def.StartFcnSpec  = 'void GT_DriverDataRecorderScalarDoublesInitialize(uint8 p1[], uint32 p2, uint8 p3[], uint32 p4, uint32 p5, uint32 p6)';
+def.StartFcnSpec  = 'void GT_DriverDataRecorderScalarDoublesInitialize(int32 work1[1], uint8 p1[], uint32 p2, uint8 p3[], uint32 p4, uint32 p5, uint32 p6)';
 def.TerminateFcnSpec = 'void GT_DriverDataRecorderScalarDoublesTerminate()';
-def.OutputFcnSpec = 'void GT_DriverDataRecorderScalarDoublesStep(uint8 p1[], uint32 p2, double u1, double u2[], uint32 p5)';
+def.OutputFcnSpec = 'void GT_DriverDataRecorderScalarDoublesStep(int32 work1[1], double u1, double u2[], uint32 p5)';
 def.HeaderFiles   = {'GT_DriverDataRecorderScalarDoubles.hpp'};
 def.SourceFiles   = {'GT_DriverDataRecorderScalarDoubles.cpp','GT_SimulinkSupport.cpp'};
 def.IncPaths      = {''};
@@ -200,9 +200,9 @@ defs = [defs; def];
 % ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 def = legacy_code('initialize');
 def.SFunctionName = 'SFunctionGTDriverDataRecorderBus';
-def.StartFcnSpec  = 'void GT_DriverDataRecorderBusInitialize(uint8 p1[], uint32 p2, uint32 p3, uint32 p4, uint8 p5[], uint32 p6, uint8 p7[], uint32 p8, uint8 p9[], uint32 p10)';
+def.StartFcnSpec  = 'void GT_DriverDataRecorderBusInitialize(int32 work1[1], uint8 p1[], uint32 p2, uint32 p3, uint32 p4, uint8 p5[], uint32 p6, uint8 p7[], uint32 p8, uint8 p9[], uint32 p10)';
 def.TerminateFcnSpec = 'void GT_DriverDataRecorderBusTerminate()';
-def.OutputFcnSpec = 'void GT_DriverDataRecorderBusStep(uint8 p1[], uint32 p2, double u1, uint8 u2[p4], uint32 p4)';
+def.OutputFcnSpec = 'void GT_DriverDataRecorderBusStep(int32 work1[1], double u1, uint8 u2[p4], uint32 p4)';
 def.HeaderFiles   = {'GT_DriverDataRecorderBus.hpp'};
 def.SourceFiles   = {'GT_DriverDataRecorderBus.cpp','GT_SimulinkSupport.cpp'};
 def.IncPaths      = {''};
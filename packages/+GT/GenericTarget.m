@@ -74,10 +74,47 @@ classdef GenericTarget < handle
         targetSoftwareDirectory;   % Directory for software on target (default: "~/GenericTarget/"). MUST BEGIN WITH '~/' AND END WITH '/'!
         targetProductName;         % Name of the executable (default: "GenericTarget").
         targetBitmaskCPUCores;     % A hexadecimal string indicating to which CPU cores the process should be pinned to. If this string is empty, all cores are used.
+        cpuAffinityTasks;          % Cell-array of hexadecimal strings indicating the CPU cores for the threads of all model tasks. A single string is used for all tasks. If empty, all cores are used.
+        cpuAffinityBaseRateScheduler; % A hexadecimal string indicating the CPU cores for the base-rate scheduler (master) thread. If this string is empty, all cores are used.
+        cpuAffinityDataRecorder;   % A hexadecimal string indicating the CPU cores for the data recording threads. If this string is empty, all cores are used.
+        cpuAffinityNetwork;        % A hexadecimal string indicating the CPU cores for the UDP receiver threads. If this string is empty, all cores are used.
         upperThreadPriority;       % Upper task priority in range [1 (lowest), 99 (highest)] (default: 89).
         priorityDataRecorder;      % Priority for the data recording threads in range [1 (lowest), 99 (highest)] (default: 30).
+        dataRecorderBufferTime;    % Time window in seconds that the preallocated buffer of each data recorder can hold if one sample is recorded per base-rate tick. Samples are dropped if the buffer is full (default: 2).
+        numDataRecorderThreads;    % Number of data recording threads that write the data files of all data recorders. Each data recorder is assigned to one of these threads (default: 1).
+        dataRecorderBlockSize;     % Size in bytes of the blocks in which data files are written, must be a multiple of 4096. Up to one block per data recorder is kept in memory until it's full, the data file is complete or the recording is stopped (default: 1048576).
+        dataRecorderDirectIO;      % True if data files should be preallocated and written with O_DIRECT, bypassing the page cache (Linux only), false otherwise (default: false).
+        taskOverrunPolicy;         % Cell-array of overrun policies for all model tasks: 'skip', 'queue-N' (N > 0) or 'restart-aligned'. A single policy is used for all tasks (default: {'skip'}).
+        taskExecutionTimeBudget;   % Execution time budgets in seconds for all model tasks, steps that take longer are counted as over budget. A single value is used for all tasks. If empty, the sampletime of each task is used (default: []).
+        taskSheddable;             % Logical values for all model tasks, true if the rate of a task may be slowed down by the load shedding under sustained overload. A single value is used for all tasks (default: false).
+        autoSampleOffsets;         % True if the sample offsets of slower tasks should be chosen automatically from measured execution times to minimize the peak CPU demand per tick, false otherwise (default: false).
+        inlineExecution;           % True if the base-rate scheduler should execute the step functions of all tasks directly in rate-monotonic order instead of using one thread per task (default: false).
+        inlineExecutionTimeThreshold; % Execution time in seconds above which a task falls back from inline execution to its own thread (default: 50e-6).
+        workerPoolSize;            % Number of worker threads that execute the steps of all tasks with work-stealing. If zero, one thread per task is used (default: 0).
+        cpuAffinityWorkerPool;     % A hexadecimal string indicating the CPU cores for the worker pool. Worker k is pinned to the k-th core of this bitmask. If this string is empty, all cores are used.
+        schedulingPolicy;          % Scheduling policy of the task threads, either 'fifo' (SCHED_FIFO) or 'deadline' (SCHED_DEADLINE with fallback to SCHED_FIFO) (default: 'fifo').
+        deadlineRuntimeMargin;     % Factor applied to the maximum measured execution time of a task to obtain its SCHED_DEADLINE runtime budget (default: 1.5).
+        measureResourceUsage;      % True if context switches and page faults of the task threads should be counted for each step via getrusage, false otherwise (default: false).
+        traceBufferSize;           % Number of trace records per thread (timer wakeups, notifications, steps, recorder flushes, UDP messages) that are kept in memory and dumped as chrome trace JSON file, zero disables tracing (default: 0).
+        lockMemory;                % True if all memory should be locked (mlockall), the heap pre-reserved and the stacks of realtime threads prefaulted at startup. If empty, memory is locked for release builds only (default: []).
+        heapReserveSize;           % Number of bytes to be reserved and prefaulted on the heap at startup if memory is locked, e.g. for data recorder and UDP buffers (default: 16777216).
+        stackPrefaultSize;         % Number of bytes to be prefaulted on the stack of each realtime thread if memory is locked (default: 262144).
+        timerMode;                 % Timer backend of the base-rate scheduler, either 'timerfd' or 'clock_nanosleep' (default: 'timerfd').
+        timerSpinTime;             % Time in seconds before each timer deadline during which the base-rate scheduler busy-spins, only used for timerMode 'clock_nanosleep' (default: 0).
+        timerAlignment;            % Reference clock to which the ticks of the base-rate scheduler are phase-locked, either 'none', 'utc' (CLOCK_REALTIME) or 'tai' (CLOCK_TAI) (default: 'none').
+        timerPhaseOffset;          % Offset in seconds of the first tick to the full second of the reference clock, only used if timerAlignment is not 'none' (default: 0).
+        tickSyncMode;              % Role of this target in the tick synchronization via UDP multicast beacons, either 'none', 'master' or 'slave' (default: 'none').
+        tickSyncGroup;             % IPv4 address [A B C D] of the multicast group for the sync beacons (default: [239 192 0 1]).
+        tickSyncPort;              % Port for the sync beacons (default: 44100).
+        tickSyncInterface;         % IPv4 address [A B C D] of the interface via which sync beacons are sent and received. If [0 0 0 0] is set, the default interface is used (default: [0 0 0 0]).
+        tickSyncInterval;          % Number of base-rate ticks between two sync beacons of the master (default: 100).
+        tickSyncLatency;           % Known network latency in seconds from the master to this slave that is compensated by the slave (default: 0).
         terminateAtTaskOverload;   % True if application should terminate at task overload, false otherwise (default: true).
         terminateAtCPUOverload;    % True if application should terminate at CPU overload, false otherwise (default: true).
+        watchdogTimeoutFactor;     % A step that runs longer than this multiple of its sampletime is reported as hung together with the backtrace of the stuck thread. If zero, the watchdog is disabled (default: 10).
+        watchdogTerminate;         % True if application should terminate if the watchdog detects a hung step, false otherwise (default: false).
+        loadShedding;              % True if the rates of sheddable tasks should be slowed down and the data recorders throttled under sustained overload, false otherwise (default: false).
+        loadSheddingFactor;        % Factor by which the sampletimes of sheddable tasks are stretched and the data recorders are decimated during load shedding (default: 4).
         customCode;                % Cell-array of files or directories containing custom code to be uploaded along with the generated code.
         numberOfOldProtocolFiles;  % The number of old protocol files to keep when redirecting the output to protocol text files.
         additionalCompilerFlags;   % Structure containing additional compiler flags to be set.
@@ -109,10 +146,47 @@ classdef GenericTarget < handle
             this.targetSoftwareDirectory = '~/GenericTarget/';
             this.targetProductName = 'GenericTarget';
             this.targetBitmaskCPUCores = '';
+            this.cpuAffinityTasks = cell.empty();
+            this.cpuAffinityBaseRateScheduler = '';
+            this.cpuAffinityDataRecorder = '';
+            this.cpuAffinityNetwork = '';
             this.upperThreadPriority = uint32(89);
             this.priorityDataRecorder = uint32(30);
+            this.dataRecorderBufferTime = 2;
+            this.numDataRecorderThreads = uint32(1);
+            this.dataRecorderBlockSize = uint32(1048576);
+            this.dataRecorderDirectIO = false;
+            this.taskOverrunPolicy = {'skip'};
+            this.taskExecutionTimeBudget = [];
+            this.taskSheddable = false;
+            this.autoSampleOffsets = false;
+            this.inlineExecution = false;
+            this.inlineExecutionTimeThreshold = 50e-6;
+            this.workerPoolSize = uint32(0);
+            this.cpuAffinityWorkerPool = '';
+            this.schedulingPolicy = 'fifo';
+            this.deadlineRuntimeMargin = 1.5;
+            this.measureResourceUsage = false;
+            this.traceBufferSize = uint32(0);
+            this.lockMemory = [];
+            this.heapReserveSize = uint32(16777216);
+            this.stackPrefaultSize = uint32(262144);
+            this.timerMode = 'timerfd';
+            this.timerSpinTime = 0;
+            this.timerAlignment = 'none';
+            this.timerPhaseOffset = 0;
+            this.tickSyncMode = 'none';
+            this.tickSyncGroup = uint8([239 192 0 1]);
+            this.tickSyncPort = uint16(44100);
+            this.tickSyncInterface = uint8([0 0 0 0]);
+            this.tickSyncInterval = uint32(100);
+            this.tickSyncLatency = 0;
             this.terminateAtTaskOverload = true;
             this.terminateAtCPUOverload = true;
+            this.watchdogTimeoutFactor = 10;
+            this.watchdogTerminate = false;
+            this.loadShedding = false;
+            this.loadSheddingFactor = uint32(4);
             this.customCode = cell.empty();
             this.numberOfOldProtocolFiles = uint32(100);
             this.additionalCompilerFlags.DEBUG_MODE = false;
@@ -729,21 +803,24 @@ classdef GenericTarget < handle
             for n = uint32(1):numTimings
                 assert(strcmp(codeInfo.OutputFunctions(n).Timing.TimingMode,'PERIODIC'), 'GT.GenericTarget.GenerateInterfaceCode(): Timing mode for all model step functions must be "PERIODIC"!');
                 assert(strcmp(codeInfo.OutputFunctions(n).Timing.TaskingMode,'IMPLICIT_TASKING'), 'GT.GenericTarget.GenerateInterfaceCode(): Tasking mode for all model step functions must be "IMPLICIT_TASKING"!');
-                assert(codeInfo.OutputFunctions(n).Timing.SampleOffset < eps, 'GT.GenericTarget.GenerateInterfaceCode(): A SampleOffset other than zero is not supported for output functions!');
                 if(codeInfo.OutputFunctions(n).Timing.SamplePeriod < baseSampleTime)
                     baseSampleTime = codeInfo.OutputFunctions(n).Timing.SamplePeriod;
                 end
             end
             strBaseSampleTime = sprintf('%.16f',baseSampleTime);
 
-            % Get priority array, sampleTick array, prototype names and task names
+            % Get priority array, sampleTick array, sampleOffsetTick array, prototype names and task names
             priorities = uint32(zeros(numTimings, 1));
             sampleTicks = uint32(zeros(numTimings, 1));
+            sampleOffsetTicks = uint32(zeros(numTimings, 1));
             stepPrototypes = string(zeros(numTimings, 1));
             taskNames = string(zeros(numTimings, 1));
             for n = uint32(1):numTimings
                 priorities(n) = codeInfo.OutputFunctions(n).Timing.Priority;
                 sampleTicks(n) = uint32(round(codeInfo.OutputFunctions(n).Timing.SamplePeriod / baseSampleTime));
+                sampleOffsetTicks(n) = uint32(round(codeInfo.OutputFunctions(n).Timing.SampleOffset / baseSampleTime));
+                assert(abs(double(sampleOffsetTicks(n)) * baseSampleTime - codeInfo.OutputFunctions(n).Timing.SampleOffset) < 1e-9, 'GT.GenericTarget.GenerateInterfaceCode(): The SampleOffset of an output function must be an integer multiple of the base sample time!');
+                assert(sampleOffsetTicks(n) < sampleTicks(n), 'GT.GenericTarget.GenerateInterfaceCode(): The SampleOffset of an output function must be less than its SamplePeriod!');
                 stepPrototypes(n) = codeInfo.OutputFunctions(n).Prototype.Name;
                 taskNames(n) = codeInfo.OutputFunctions(n).Timing.NonFcnCallPartitionName;
             end
@@ -754,19 +831,163 @@ classdef GenericTarget < handle
 
             % Generate strings
             strArraySampleTicks = sprintf('%d',sampleTicks(1));
+            strArraySampleOffsetTicks = sprintf('%d',sampleOffsetTicks(1));
             strArrayPriorities = sprintf('%d',priorities(1));
             strArrayTaskNames = sprintf('"%s"',taskNames(1));
             strStepSwitch = sprintf('        case 0: model.%s(); break;',stepPrototypes(1));
             for n = uint32(2):numTimings
                 strArraySampleTicks = strcat(strArraySampleTicks, sprintf(',%d',sampleTicks(n)));
+                strArraySampleOffsetTicks = strcat(strArraySampleOffsetTicks, sprintf(',%d',sampleOffsetTicks(n)));
                 strArrayPriorities = strcat(strArrayPriorities, sprintf(',%d',priorities(n)));
                 strStepSwitch = [strStepSwitch, sprintf('\n        case %d: model.%s(); break;',uint32(n-1),stepPrototypes(n))];
                 strArrayTaskNames = [strArrayTaskNames, sprintf(', "%s"',taskNames(n))];
             end
 
+            % Get CPU affinity masks for all task threads (a single mask is used for all tasks)
+            cpuAffinityTasks = repmat({''}, numTimings, 1);
+            if(1 == numel(this.cpuAffinityTasks))
+                cpuAffinityTasks(:) = this.cpuAffinityTasks(1);
+            elseif(numel(this.cpuAffinityTasks))
+                assert(numel(this.cpuAffinityTasks) == numTimings, 'GT.GenericTarget.GenerateInterfaceCode(): Property "cpuAffinityTasks" must contain either one hexadecimal string or one hexadecimal string for each of the %d model step functions!', numTimings);
+                cpuAffinityTasks = this.cpuAffinityTasks;
+            end
+            strArrayCPUAffinity = this.CPUAffinityToCode(cpuAffinityTasks{1});
+            for n = uint32(2):numTimings
+                strArrayCPUAffinity = [strArrayCPUAffinity, ',', this.CPUAffinityToCode(cpuAffinityTasks{n})];
+            end
+
+            % Get overrun policies and activation queue sizes for all tasks (a single policy is used for all tasks)
+            taskOverrunPolicy = repmat(this.taskOverrunPolicy(1), numTimings, 1);
+            if(numel(this.taskOverrunPolicy) > 1)
+                assert(numel(this.taskOverrunPolicy) == numTimings, 'GT.GenericTarget.GenerateInterfaceCode(): Property "taskOverrunPolicy" must contain either one policy or one policy for each of the %d model step functions!', numTimings);
+                taskOverrunPolicy = this.taskOverrunPolicy;
+            end
+            strArrayOverrunPolicies = '';
+            strArrayActivationQueueSizes = '';
+            for n = uint32(1):numTimings
+                [policy, queueSize] = this.ParseOverrunPolicy(taskOverrunPolicy{n});
+                if(n > 1)
+                    strArrayOverrunPolicies = [strArrayOverrunPolicies, ','];
+                    strArrayActivationQueueSizes = [strArrayActivationQueueSizes, ','];
+                end
+                strArrayOverrunPolicies = [strArrayOverrunPolicies, sprintf('%d',policy)];
+                strArrayActivationQueueSizes = [strArrayActivationQueueSizes, sprintf('%d',queueSize)];
+            end
+
+            % Get execution time budgets for all tasks (a single budget is used for all tasks, the sampletime is used by default)
+            executionTimeBudgets = double(sampleTicks) * baseSampleTime;
+            if(1 == numel(this.taskExecutionTimeBudget))
+                executionTimeBudgets(:) = this.taskExecutionTimeBudget(1);
+            elseif(numel(this.taskExecutionTimeBudget))
+                assert(numel(this.taskExecutionTimeBudget) == numTimings, 'GT.GenericTarget.GenerateInterfaceCode(): Property "taskExecutionTimeBudget" must contain either one value or one value for each of the %d model step functions!', numTimings);
+                executionTimeBudgets = this.taskExecutionTimeBudget(:);
+            end
+            strArrayExecutionTimeBudgets = strjoin(arrayfun(@(x) sprintf('%.16f',x), executionTimeBudgets(:)', 'UniformOutput', false), ',');
+
+            % Get sheddable flags for all tasks (a single flag is used for all tasks)
+            sheddable = false(numTimings, 1);
+            if(1 == numel(this.taskSheddable))
+                sheddable(:) = this.taskSheddable(1);
+            elseif(numel(this.taskSheddable))
+                assert(numel(this.taskSheddable) == numTimings, 'GT.GenericTarget.GenerateInterfaceCode(): Property "taskSheddable" must contain either one value or one value for each of the %d model step functions!', numTimings);
+                sheddable = this.taskSheddable(:);
+            end
+            strArraySheddable = strjoin(arrayfun(@(x) char(string(x)), sheddable(:)', 'UniformOutput', false), ',');
+
+            % Get automatic sample offset setting
+            strAutoSampleOffsets = 'false';
+            if(this.autoSampleOffsets)
+                strAutoSampleOffsets = 'true';
+            end
+
+            % Get load shedding settings
+            strLoadShedding = 'false';
+            if(this.loadShedding)
+                strLoadShedding = 'true';
+            end
+            strLoadSheddingFactor = sprintf('%d',this.loadSheddingFactor);
+
+            % Get CPU affinity masks for base-rate scheduler, data recording threads and network threads
+            strCPUAffinityBaseRateScheduler = this.CPUAffinityToCode(this.cpuAffinityBaseRateScheduler);
+            strCPUAffinityDataRecorder = this.CPUAffinityToCode(this.cpuAffinityDataRecorder);
+            strCPUAffinityNetwork = this.CPUAffinityToCode(this.cpuAffinityNetwork);
+
             % Get priority for data recording thread
             strpriorityDataRecorder = sprintf('%d',this.priorityDataRecorder);
 
+            % Get buffer time window for data recorders
+            strDataRecorderBufferTime = sprintf('%.16f',this.dataRecorderBufferTime);
+            strNumDataRecorderThreads = sprintf('%d',this.numDataRecorderThreads);
+            strDataRecorderBlockSize = sprintf('%d',this.dataRecorderBlockSize);
+            strDataRecorderDirectIO = 'false';
+            if(this.dataRecorderDirectIO)
+                strDataRecorderDirectIO = 'true';
+            end
+
+            % Get inline execution settings
+            strInlineExecution = 'false';
+            if(this.inlineExecution)
+                strInlineExecution = 'true';
+            end
+            strInlineExecutionTimeThreshold = sprintf('%.16f',this.inlineExecutionTimeThreshold);
+
+            % Get worker pool settings
+            strWorkerPoolSize = sprintf('%d',this.workerPoolSize);
+            strCPUAffinityWorkerPool = this.CPUAffinityToCode(this.cpuAffinityWorkerPool);
+
+            % Get scheduling policy of task threads
+            strSchedulingPolicy = '0';
+            if(strcmp(this.schedulingPolicy, 'deadline'))
+                strSchedulingPolicy = '1';
+            end
+            strDeadlineRuntimeMargin = sprintf('%.16f',this.deadlineRuntimeMargin);
+
+            % Get resource usage measurement setting
+            strMeasureResourceUsage = 'false';
+            if(this.measureResourceUsage)
+                strMeasureResourceUsage = 'true';
+            end
+
+            % Get trace setting
+            strTraceBufferSize = sprintf('%d',this.traceBufferSize);
+
+            % Get memory locking settings (locked for release builds by default)
+            strLockMemory = 'false';
+            if((isempty(this.lockMemory) && ~this.additionalCompilerFlags.DEBUG_MODE) || (~isempty(this.lockMemory) && this.lockMemory))
+                strLockMemory = 'true';
+            end
+            strHeapReserveSize = sprintf('%d',this.heapReserveSize);
+            strStackPrefaultSize = sprintf('%d',this.stackPrefaultSize);
+
+            % Get timer backend and spin time
+            strTimerMode = '0';
+            if(strcmp(this.timerMode, 'clock_nanosleep'))
+                strTimerMode = '1';
+            end
+            strTimerSpinTime = sprintf('%.16f',this.timerSpinTime);
+
+            % Get timer alignment and phase offset
+            strTimerAlignment = '0';
+            if(strcmp(this.timerAlignment, 'utc'))
+                strTimerAlignment = '1';
+            elseif(strcmp(this.timerAlignment, 'tai'))
+                strTimerAlignment = '2';
+            end
+            strTimerPhaseOffset = sprintf('%.16f',this.timerPhaseOffset);
+
+            % Get tick synchronization
+            strTickSyncMode = '0';
+            if(strcmp(this.tickSyncMode, 'master'))
+                strTickSyncMode = '1';
+            elseif(strcmp(this.tickSyncMode, 'slave'))
+                strTickSyncMode = '2';
+            end
+            strArrayTickSyncGroup = sprintf('%d,%d,%d,%d',this.tickSyncGroup(1),this.tickSyncGroup(2),this.tickSyncGroup(3),this.tickSyncGroup(4));
+            strTickSyncPort = sprintf('%d',this.tickSyncPort);
+            strArrayTickSyncInterface = sprintf('%d,%d,%d,%d',this.tickSyncInterface(1),this.tickSyncInterface(2),this.tickSyncInterface(3),this.tickSyncInterface(4));
+            strTickSyncInterval = sprintf('%d',this.tickSyncInterval);
+            strTickSyncLatency = sprintf('%.16f',this.tickSyncLatency);
+
             % Get port for application socket
             strPortAppSocket = sprintf('%d',this.portAppSocket);
 
@@ -776,6 +997,13 @@ classdef GenericTarget < handle
                 strTerminateAtTaskOverload = 'true';
             end
 
+            % Get watchdog settings
+            strWatchdogTimeoutFactor = sprintf('%.16f',this.watchdogTimeoutFactor);
+            strWatchdogTerminate = 'false';
+            if(this.watchdogTerminate)
+                strWatchdogTerminate = 'true';
+            end
+
             % Get CPU overload behaviour
             strTerminateAtCPUOverload = 'false';
             if(this.terminateAtCPUOverload)
@@ -804,6 +1032,10 @@ classdef GenericTarget < handle
             strSource = strrep(strSource, '$BASE_SAMPLE_TIME$', strBaseSampleTime);
             strHeader = strrep(strHeader, '$ARRAY_SAMPLE_TICKS$', strArraySampleTicks);
             strSource = strrep(strSource, '$ARRAY_SAMPLE_TICKS$', strArraySampleTicks);
+            strHeader = strrep(strHeader, '$ARRAY_SAMPLE_OFFSET_TICKS$', strArraySampleOffsetTicks);
+            strSource = strrep(strSource, '$ARRAY_SAMPLE_OFFSET_TICKS$', strArraySampleOffsetTicks);
+            strHeader = strrep(strHeader, '$AUTO_SAMPLE_OFFSETS$', strAutoSampleOffsets);
+            strSource = strrep(strSource, '$AUTO_SAMPLE_OFFSETS$', strAutoSampleOffsets);
             strHeader = strrep(strHeader, '$ARRAY_PRIORITIES$', strArrayPriorities);
             strSource = strrep(strSource, '$ARRAY_PRIORITIES$', strArrayPriorities);
             strHeader = strrep(strHeader, '$ARRAY_TASK_NAMES$', strArrayTaskNames);
@@ -812,6 +1044,14 @@ classdef GenericTarget < handle
             strSource = strrep(strSource, '$STEP_SWITCH$', strStepSwitch);
             strHeader = strrep(strHeader, '$PRIORITY_DATA_RECORDER$', strpriorityDataRecorder);
             strSource = strrep(strSource, '$PRIORITY_DATA_RECORDER$', strpriorityDataRecorder);
+            strHeader = strrep(strHeader, '$DATA_RECORDER_BUFFER_TIME$', strDataRecorderBufferTime);
+            strSource = strrep(strSource, '$DATA_RECORDER_BUFFER_TIME$', strDataRecorderBufferTime);
+            strHeader = strrep(strHeader, '$NUM_DATA_RECORDER_THREADS$', strNumDataRecorderThreads);
+            strSource = strrep(strSource, '$NUM_DATA_RECORDER_THREADS$', strNumDataRecorderThreads);
+            strHeader = strrep(strHeader, '$DATA_RECORDER_BLOCK_SIZE$', strDataRecorderBlockSize);
+            strSource = strrep(strSource, '$DATA_RECORDER_BLOCK_SIZE$', strDataRecorderBlockSize);
+            strHeader = strrep(strHeader, '$DATA_RECORDER_DIRECT_IO$', strDataRecorderDirectIO);
+            strSource = strrep(strSource, '$DATA_RECORDER_DIRECT_IO$', strDataRecorderDirectIO);
             strHeader = strrep(strHeader, '$PORT_APP_SOCKET$', strPortAppSocket);
             strSource = strrep(strSource, '$PORT_APP_SOCKET$', strPortAppSocket);
             strHeader = strrep(strHeader, '$TERMINATE_AT_TASK_OVERLOAD$', strTerminateAtTaskOverload);
@@ -820,6 +1060,90 @@ classdef GenericTarget < handle
             strSource = strrep(strSource, '$TERMINATE_AT_CPU_OVERLOAD$', strTerminateAtCPUOverload);
             strHeader = strrep(strHeader, '$NUMBER_OF_OLD_PROTOCOL_FILES$', strNumberOfOldProtocolFiles);
             strSource = strrep(strSource, '$NUMBER_OF_OLD_PROTOCOL_FILES$', strNumberOfOldProtocolFiles);
+            strHeader = strrep(strHeader, '$ARRAY_CPU_AFFINITY$', strArrayCPUAffinity);
+            strSource = strrep(strSource, '$ARRAY_CPU_AFFINITY$', strArrayCPUAffinity);
+            strHeader = strrep(strHeader, '$CPU_AFFINITY_BASE_RATE_SCHEDULER$', strCPUAffinityBaseRateScheduler);
+            strSource = strrep(strSource, '$CPU_AFFINITY_BASE_RATE_SCHEDULER$', strCPUAffinityBaseRateScheduler);
+            strHeader = strrep(strHeader, '$CPU_AFFINITY_DATA_RECORDER$', strCPUAffinityDataRecorder);
+            strSource = strrep(strSource, '$CPU_AFFINITY_DATA_RECORDER$', strCPUAffinityDataRecorder);
+            strHeader = strrep(strHeader, '$CPU_AFFINITY_NETWORK$', strCPUAffinityNetwork);
+            strSource = strrep(strSource, '$CPU_AFFINITY_NETWORK$', strCPUAffinityNetwork);
+            strHeader = strrep(strHeader, '$ARRAY_OVERRUN_POLICIES$', strArrayOverrunPolicies);
+            strSource = strrep(strSource, '$ARRAY_OVERRUN_POLICIES$', strArrayOverrunPolicies);
+            strHeader = strrep(strHeader, '$ARRAY_ACTIVATION_QUEUE_SIZES$', strArrayActivationQueueSizes);
+            strSource = strrep(strSource, '$ARRAY_ACTIVATION_QUEUE_SIZES$', strArrayActivationQueueSizes);
+            strHeader = strrep(strHeader, '$INLINE_EXECUTION$', strInlineExecution);
+            strSource = strrep(strSource, '$INLINE_EXECUTION$', strInlineExecution);
+            strHeader = strrep(strHeader, '$INLINE_EXECUTION_TIME_THRESHOLD$', strInlineExecutionTimeThreshold);
+            strSource = strrep(strSource, '$INLINE_EXECUTION_TIME_THRESHOLD$', strInlineExecutionTimeThreshold);
+            strHeader = strrep(strHeader, '$WORKER_POOL_SIZE$', strWorkerPoolSize);
+            strSource = strrep(strSource, '$WORKER_POOL_SIZE$', strWorkerPoolSize);
+            strHeader = strrep(strHeader, '$CPU_AFFINITY_WORKER_POOL$', strCPUAffinityWorkerPool);
+            strSource = strrep(strSource, '$CPU_AFFINITY_WORKER_POOL$', strCPUAffinityWorkerPool);
+            strHeader = strrep(strHeader, '$ARRAY_EXECUTION_TIME_BUDGETS$', strArrayExecutionTimeBudgets);
+            strSource = strrep(strSource, '$ARRAY_EXECUTION_TIME_BUDGETS$', strArrayExecutionTimeBudgets);
+            strHeader = strrep(strHeader, '$ARRAY_SHEDDABLE$', strArraySheddable);
+            strSource = strrep(strSource, '$ARRAY_SHEDDABLE$', strArraySheddable);
+            strHeader = strrep(strHeader, '$SCHEDULING_POLICY$', strSchedulingPolicy);
+            strSource = strrep(strSource, '$SCHEDULING_POLICY$', strSchedulingPolicy);
+            strHeader = strrep(strHeader, '$DEADLINE_RUNTIME_MARGIN$', strDeadlineRuntimeMargin);
+            strSource = strrep(strSource, '$DEADLINE_RUNTIME_MARGIN$', strDeadlineRuntimeMargin);
+            strHeader = strrep(strHeader, '$MEASURE_RESOURCE_USAGE$', strMeasureResourceUsage);
+            strSource = strrep(strSource, '$MEASURE_RESOURCE_USAGE$', strMeasureResourceUsage);
+            strHeader = strrep(strHeader, '$TRACE_BUFFER_SIZE$', strTraceBufferSize);
+            strSource = strrep(strSource, '$TRACE_BUFFER_SIZE$', strTraceBufferSize);
+            strHeader = strrep(strHeader, '$LOCK_MEMORY$', strLockMemory);
+            strSource = strrep(strSource, '$LOCK_MEMORY$', strLockMemory);
+            strHeader = strrep(strHeader, '$HEAP_RESERVE_SIZE$', strHeapReserveSize);
+            strSource = strrep(strSource, '$HEAP_RESERVE_SIZE$', strHeapReserveSize);
+            strHeader = strrep(strHeader, '$STACK_PREFAULT_SIZE$', strStackPrefaultSize);
+            strSource = strrep(strSource, '$STACK_PREFAULT_SIZE$', strStackPrefaultSize);
+            strHeader = strrep(strHeader, '$TIMER_MODE$', strTimerMode);
+            strSource = strrep(strSource, '$TIMER_MODE$', strTimerMode);
+            strHeader = strrep(strHeader, '$TIMER_SPIN_TIME$', strTimerSpinTime);
+            strSource = strrep(strSource, '$TIMER_SPIN_TIME$', strTimerSpinTime);
+            strHeader = strrep(strHeader, '$TIMER_ALIGNMENT$', strTimerAlignment);
+            strSource = strrep(strSource, '$TIMER_ALIGNMENT$', strTimerAlignment);
+            strHeader = strrep(strHeader, '$TIMER_PHASE_OFFSET$', strTimerPhaseOffset);
+            strSource = strrep(strSource, '$TIMER_PHASE_OFFSET$', strTimerPhaseOffset);
+            strHeader = strrep(strHeader, '$TICK_SYNC_MODE$', strTickSyncMode);
+            strSource = strrep(strSource, '$TICK_SYNC_MODE$', strTickSyncMode);
+            strHeader = strrep(strHeader, '$ARRAY_TICK_SYNC_GROUP$', strArrayTickSyncGroup);
+            strSource = strrep(strSource, '$ARRAY_TICK_SYNC_GROUP$', strArrayTickSyncGroup);
+            strHeader = strrep(strHeader, '$TICK_SYNC_PORT$', strTickSyncPort);
+            strSource = strrep(strSource, '$TICK_SYNC_PORT$', strTickSyncPort);
+            strHeader = strrep(strHeader, '$ARRAY_TICK_SYNC_INTERFACE$', strArrayTickSyncInterface);
+            strSource = strrep(strSource, '$ARRAY_TICK_SYNC_INTERFACE$', strArrayTickSyncInterface);
+            strHeader = strrep(strHeader, '$TICK_SYNC_INTERVAL$', strTickSyncInterval);
+            strSource = strrep(strSource, '$TICK_SYNC_INTERVAL$', strTickSyncInterval);
+            strHeader = strrep(strHeader, '$TICK_SYNC_LATENCY$', strTickSyncLatency);
+            strSource = strrep(strSource, '$TICK_SYNC_LATENCY$', strTickSyncLatency);
+            strHeader = strrep(strHeader, '$WATCHDOG_TIMEOUT_FACTOR$', strWatchdogTimeoutFactor);
+            strSource = strrep(strSource, '$WATCHDOG_TIMEOUT_FACTOR$', strWatchdogTimeoutFactor);
+            strHeader = strrep(strHeader, '$WATCHDOG_TERMINATE$', strWatchdogTerminate);
+            strSource = strrep(strSource, '$WATCHDOG_TERMINATE$', strWatchdogTerminate);
+            strHeader = strrep(strHeader, '$LOAD_SHEDDING$', strLoadShedding);
+            strSource = strrep(strSource, '$LOAD_SHEDDING$', strLoadShedding);
+            strHeader = strrep(strHeader, '$LOAD_SHEDDING_FACTOR$', strLoadSheddingFactor);
+            strSource = strrep(strSource, '$LOAD_SHEDDING_FACTOR$', strLoadSheddingFactor);
+        end
+        function [policy, queueSize] = ParseOverrunPolicy(this, strPolicy)
+            % Convert an overrun policy string to the policy ID (0: skip, 1: queue, 2: restart-aligned) and the activation queue size
+            policy = uint32(0);
+            queueSize = uint32(1);
+            if(startsWith(strPolicy,'queue-'))
+                policy = uint32(1);
+                queueSize = uint32(str2double(strPolicy(7:end)));
+            elseif(strcmp(strPolicy,'restart-aligned'))
+                policy = uint32(2);
+            end
+        end
+        function strCode = CPUAffinityToCode(this, hexString)
+            % Convert a hexadecimal CPU bitmask string to a C++ literal (an empty string results in 0, which means no CPU affinity)
+            strCode = '0x0ULL';
+            if(~isempty(hexString))
+                strCode = ['0x' upper(hexString(3:end)) 'ULL'];
+            end
         end
         function CompressReleaseFolder(this, releaseFolder, zipFileName)
             % Get all listings from the release folder
@@ -872,6 +1196,18 @@ classdef GenericTarget < handle
                 assert(numel(i) && (sum(i) == numel(i)), 'Property "targetBitmaskCPUCores" must be either an empty string or a hexadecimal string, e.g. "0xFF"!');
             end
 
+            % cpuAffinityTasks, cpuAffinityBaseRateScheduler, cpuAffinityDataRecorder, cpuAffinityNetwork
+            if(ischar(this.cpuAffinityTasks))
+                this.cpuAffinityTasks = {this.cpuAffinityTasks};
+            end
+            assert(iscellstr(this.cpuAffinityTasks), 'Property "cpuAffinityTasks" must be a cell array of strings!');
+            for i = 1:numel(this.cpuAffinityTasks)
+                this.CheckCPUAffinity(this.cpuAffinityTasks{i}, 'cpuAffinityTasks');
+            end
+            this.CheckCPUAffinity(this.cpuAffinityBaseRateScheduler, 'cpuAffinityBaseRateScheduler');
+            this.CheckCPUAffinity(this.cpuAffinityDataRecorder, 'cpuAffinityDataRecorder');
+            this.CheckCPUAffinity(this.cpuAffinityNetwork, 'cpuAffinityNetwork');
+
             % upperThreadPriority
             assert(isscalar(this.upperThreadPriority), 'Property "upperThreadPriority" must be scalar!');
             this.upperThreadPriority = uint32(this.upperThreadPriority);
@@ -882,6 +1218,118 @@ classdef GenericTarget < handle
             this.priorityDataRecorder = uint32(this.priorityDataRecorder);
             assert((this.priorityDataRecorder > 0) && (this.priorityDataRecorder < 100), 'Property "priorityDataRecorder" must be in range [1, 99]!');
 
+            % dataRecorderBufferTime
+            assert(isscalar(this.dataRecorderBufferTime), 'Property "dataRecorderBufferTime" must be scalar!');
+            this.dataRecorderBufferTime = double(this.dataRecorderBufferTime);
+            assert(isfinite(this.dataRecorderBufferTime) && (this.dataRecorderBufferTime > 0), 'Property "dataRecorderBufferTime" must be a positive value!');
+
+            % numDataRecorderThreads
+            assert(isscalar(this.numDataRecorderThreads), 'Property "numDataRecorderThreads" must be scalar!');
+            this.numDataRecorderThreads = uint32(this.numDataRecorderThreads);
+            assert(this.numDataRecorderThreads > 0, 'Property "numDataRecorderThreads" must be greater than zero!');
+
+            % dataRecorderBlockSize
+            assert(isscalar(this.dataRecorderBlockSize), 'Property "dataRecorderBlockSize" must be scalar!');
+            this.dataRecorderBlockSize = uint32(this.dataRecorderBlockSize);
+            assert((this.dataRecorderBlockSize > 0) && (0 == mod(this.dataRecorderBlockSize, 4096)), 'Property "dataRecorderBlockSize" must be a positive multiple of 4096!');
+
+            % dataRecorderDirectIO
+            assert(isscalar(this.dataRecorderDirectIO), 'Property "dataRecorderDirectIO" must be scalar!');
+            this.dataRecorderDirectIO = logical(this.dataRecorderDirectIO);
+
+            % taskOverrunPolicy
+            if(ischar(this.taskOverrunPolicy))
+                this.taskOverrunPolicy = {this.taskOverrunPolicy};
+            end
+            assert(iscellstr(this.taskOverrunPolicy) && ~isempty(this.taskOverrunPolicy), 'Property "taskOverrunPolicy" must be a non-empty cell array of strings!');
+            for i = 1:numel(this.taskOverrunPolicy)
+                strPolicy = this.taskOverrunPolicy{i};
+                isQueue = startsWith(strPolicy,'queue-') && all(isstrprop(strPolicy(7:end),'digit')) && (numel(strPolicy) > 6) && (str2double(strPolicy(7:end)) > 0) && (str2double(strPolicy(7:end)) <= intmax('uint32'));
+                assert(isQueue || any(strcmp(strPolicy, {'skip','restart-aligned'})), 'Property "taskOverrunPolicy" must contain only ''skip'', ''queue-N'' (N > 0) or ''restart-aligned''!');
+            end
+
+            % taskExecutionTimeBudget
+            assert(isnumeric(this.taskExecutionTimeBudget) && (isempty(this.taskExecutionTimeBudget) || isvector(this.taskExecutionTimeBudget)), 'Property "taskExecutionTimeBudget" must be empty or a numeric vector!');
+            this.taskExecutionTimeBudget = double(this.taskExecutionTimeBudget);
+            assert(all(isfinite(this.taskExecutionTimeBudget)) && all(this.taskExecutionTimeBudget >= 0), 'Property "taskExecutionTimeBudget" must contain non-negative values!');
+
+            % taskSheddable
+            assert((islogical(this.taskSheddable) || isnumeric(this.taskSheddable)) && (isempty(this.taskSheddable) || isvector(this.taskSheddable)), 'Property "taskSheddable" must be empty or a logical vector!');
+            this.taskSheddable = logical(this.taskSheddable);
+
+            % inlineExecution
+            assert(isscalar(this.inlineExecution), 'Property "inlineExecution" must be scalar!');
+            this.inlineExecution = logical(this.inlineExecution);
+
+            % inlineExecutionTimeThreshold
+            assert(isscalar(this.inlineExecutionTimeThreshold), 'Property "inlineExecutionTimeThreshold" must be scalar!');
+            this.inlineExecutionTimeThreshold = double(this.inlineExecutionTimeThreshold);
+            assert(isfinite(this.inlineExecutionTimeThreshold) && (this.inlineExecutionTimeThreshold >= 0), 'Property "inlineExecutionTimeThreshold" must be a non-negative value!');
+
+            % workerPoolSize, cpuAffinityWorkerPool
+            assert(isscalar(this.workerPoolSize), 'Property "workerPoolSize" must be scalar!');
+            this.workerPoolSize = uint32(this.workerPoolSize);
+            this.CheckCPUAffinity(this.cpuAffinityWorkerPool, 'cpuAffinityWorkerPool');
+
+            % schedulingPolicy, deadlineRuntimeMargin
+            assert(ischar(this.schedulingPolicy), 'Property "schedulingPolicy" must be a string!');
+            assert(any(strcmp(this.schedulingPolicy, {'fifo','deadline'})), 'Property "schedulingPolicy" must be either ''fifo'' or ''deadline''!');
+            assert(isscalar(this.deadlineRuntimeMargin), 'Property "deadlineRuntimeMargin" must be scalar!');
+            this.deadlineRuntimeMargin = double(this.deadlineRuntimeMargin);
+            assert(isfinite(this.deadlineRuntimeMargin) && (this.deadlineRuntimeMargin > 0), 'Property "deadlineRuntimeMargin" must be a positive value!');
+
+            % measureResourceUsage
+            assert(isscalar(this.measureResourceUsage), 'Property "measureResourceUsage" must be scalar!');
+            this.measureResourceUsage = logical(this.measureResourceUsage);
+
+            % traceBufferSize
+            assert(isscalar(this.traceBufferSize), 'Property "traceBufferSize" must be scalar!');
+            this.traceBufferSize = uint32(this.traceBufferSize);
+
+            % lockMemory, heapReserveSize, stackPrefaultSize
+            assert(isempty(this.lockMemory) || isscalar(this.lockMemory), 'Property "lockMemory" must be empty or scalar!');
+            if(~isempty(this.lockMemory))
+                this.lockMemory = logical(this.lockMemory);
+            end
+            assert(isscalar(this.heapReserveSize), 'Property "heapReserveSize" must be scalar!');
+            this.heapReserveSize = uint32(this.heapReserveSize);
+            assert(isscalar(this.stackPrefaultSize), 'Property "stackPrefaultSize" must be scalar!');
+            this.stackPrefaultSize = uint32(this.stackPrefaultSize);
+
+            % timerMode
+            assert(ischar(this.timerMode), 'Property "timerMode" must be a string!');
+            assert(any(strcmp(this.timerMode, {'timerfd','clock_nanosleep'})), 'Property "timerMode" must be either ''timerfd'' or ''clock_nanosleep''!');
+
+            % timerSpinTime
+            assert(isscalar(this.timerSpinTime), 'Property "timerSpinTime" must be scalar!');
+            this.timerSpinTime = double(this.timerSpinTime);
+            assert(isfinite(this.timerSpinTime) && (this.timerSpinTime >= 0), 'Property "timerSpinTime" must be a non-negative value!');
+
+            % timerAlignment, timerPhaseOffset
+            assert(ischar(this.timerAlignment), 'Property "timerAlignment" must be a string!');
+            assert(any(strcmp(this.timerAlignment, {'none','utc','tai'})), 'Property "timerAlignment" must be either ''none'', ''utc'' or ''tai''!');
+            assert(isscalar(this.timerPhaseOffset), 'Property "timerPhaseOffset" must be scalar!');
+            this.timerPhaseOffset = double(this.timerPhaseOffset);
+            assert(isfinite(this.timerPhaseOffset) && (this.timerPhaseOffset >= 0) && (this.timerPhaseOffset < 1), 'Property "timerPhaseOffset" must be in range [0, 1)!');
+
+            % tickSyncMode, tickSyncGroup, tickSyncPort, tickSyncInterface, tickSyncInterval, tickSyncLatency
+            assert(ischar(this.tickSyncMode), 'Property "tickSyncMode" must be a string!');
+            assert(any(strcmp(this.tickSyncMode, {'none','master','slave'})), 'Property "tickSyncMode" must be either ''none'', ''master'' or ''slave''!');
+            assert(~(strcmp(this.tickSyncMode, 'slave') && ~strcmp(this.timerAlignment, 'none')), 'Property "tickSyncMode" must not be ''slave'' if property "timerAlignment" is not ''none''!');
+            assert(isnumeric(this.tickSyncGroup) && (4 == numel(this.tickSyncGroup)), 'Property "tickSyncGroup" must be a 4-element vector!');
+            this.tickSyncGroup = uint8(this.tickSyncGroup);
+            assert((this.tickSyncGroup(1) >= 224) && (this.tickSyncGroup(1) <= 239), 'Property "tickSyncGroup" must be a multicast address in range [224.0.0.0, 239.255.255.255]!');
+            assert(isscalar(this.tickSyncPort), 'Property "tickSyncPort" must be scalar!');
+            this.tickSyncPort = uint16(this.tickSyncPort);
+            assert(isnumeric(this.tickSyncInterface) && (4 == numel(this.tickSyncInterface)), 'Property "tickSyncInterface" must be a 4-element vector!');
+            this.tickSyncInterface = uint8(this.tickSyncInterface);
+            assert(isscalar(this.tickSyncInterval), 'Property "tickSyncInterval" must be scalar!');
+            this.tickSyncInterval = uint32(this.tickSyncInterval);
+            assert(this.tickSyncInterval > 0, 'Property "tickSyncInterval" must be greater than zero!');
+            assert(isscalar(this.tickSyncLatency), 'Property "tickSyncLatency" must be scalar!');
+            this.tickSyncLatency = double(this.tickSyncLatency);
+            assert(isfinite(this.tickSyncLatency) && (this.tickSyncLatency >= 0), 'Property "tickSyncLatency" must be a non-negative value!');
+
             % terminateAtTaskOverload
             assert(isscalar(this.terminateAtTaskOverload), 'Property "terminateAtTaskOverload" must be scalar!');
             this.terminateAtTaskOverload = logical(this.terminateAtTaskOverload);
@@ -890,6 +1338,28 @@ classdef GenericTarget < handle
             assert(isscalar(this.terminateAtCPUOverload), 'Property "terminateAtCPUOverload" must be scalar!');
             this.terminateAtCPUOverload = logical(this.terminateAtCPUOverload);
 
+            % watchdogTimeoutFactor
+            assert(isscalar(this.watchdogTimeoutFactor), 'Property "watchdogTimeoutFactor" must be scalar!');
+            this.watchdogTimeoutFactor = double(this.watchdogTimeoutFactor);
+            assert(isfinite(this.watchdogTimeoutFactor) && (this.watchdogTimeoutFactor >= 0), 'Property "watchdogTimeoutFactor" must be a non-negative value!');
+
+            % watchdogTerminate
+            assert(isscalar(this.watchdogTerminate), 'Property "watchdogTerminate" must be scalar!');
+            this.watchdogTerminate = logical(this.watchdogTerminate);
+
+            % autoSampleOffsets
+            assert(isscalar(this.autoSampleOffsets), 'Property "autoSampleOffsets" must be scalar!');
+            this.autoSampleOffsets = logical(this.autoSampleOffsets);
+
+            % loadShedding
+            assert(isscalar(this.loadShedding), 'Property "loadShedding" must be scalar!');
+            this.loadShedding = logical(this.loadShedding);
+
+            % loadSheddingFactor
+            assert(isscalar(this.loadSheddingFactor), 'Property "loadSheddingFactor" must be scalar!');
+            this.loadSheddingFactor = uint32(this.loadSheddingFactor);
+            assert(this.loadSheddingFactor > 1, 'Property "loadSheddingFactor" must be greater than one!');
+
             % customCode
             assert(iscellstr(this.customCode), 'Property "customCode" must be a cell array of strings!');
             this.customCode = unique(this.customCode);
@@ -914,6 +1384,15 @@ classdef GenericTarget < handle
             assert(iscellstr(this.additionalCompilerFlags.LD_FLAGS), 'Property "additionalCompilerFlags.LD_FLAGS" must be a cell array of strings!');
             this.additionalCompilerFlags.LD_FLAGS = unique(this.additionalCompilerFlags.LD_FLAGS);
         end
+        function CheckCPUAffinity(this, hexString, propertyName)
+            assert(ischar(hexString), ['Property "' propertyName '" must be a string!']);
+            if(~isempty(hexString))
+                assert(startsWith(hexString,'0x'), ['Property "' propertyName '" must start with "0x"!']);
+                i = isstrprop(hexString(3:end),'xdigit');
+                assert(numel(i) && (sum(i) == numel(i)), ['Property "' propertyName '" must be either an empty string or a hexadecimal string, e.g. "0xFF"!']);
+                assert(numel(i) <= 16, ['Property "' propertyName '" must not contain more than 16 hexadecimal digits (CPU cores 0 to 63)!']);
+            end
+        end
         function cmdout = RunCommand(this, cmd)
             [~,cmdout] = system(cmd,'-echo');
         end
@@ -5,14 +5,53 @@
 const std::string SimulinkInterface::modelName("$NAME_OF_MODEL$");
 const uint16_t SimulinkInterface::portAppSocket = $PORT_APP_SOCKET$;
 const int32_t SimulinkInterface::priorityDataRecorder = $PRIORITY_DATA_RECORDER$;
+const double SimulinkInterface::dataRecorderBufferTime = $DATA_RECORDER_BUFFER_TIME$;
+const uint32_t SimulinkInterface::numDataRecorderThreads = $NUM_DATA_RECORDER_THREADS$;
+const uint32_t SimulinkInterface::dataRecorderBlockSize = $DATA_RECORDER_BLOCK_SIZE$;
+const bool SimulinkInterface::dataRecorderDirectIO = $DATA_RECORDER_DIRECT_IO$;
 const double SimulinkInterface::baseSampleTime = $BASE_SAMPLE_TIME$;
 const int32_t SimulinkInterface::sampleTicks[] = {$ARRAY_SAMPLE_TICKS$};
+const uint32_t SimulinkInterface::sampleOffsetTicks[] = {$ARRAY_SAMPLE_OFFSET_TICKS$};
+const bool SimulinkInterface::autoSampleOffsets = $AUTO_SAMPLE_OFFSETS$;
 const int32_t SimulinkInterface::priorities[] = {$ARRAY_PRIORITIES$};
 $NAME_OF_CLASS$ SimulinkInterface::model;
 const char* SimulinkInterface::taskNames[] = {$ARRAY_TASK_NAMES$};
 const bool SimulinkInterface::terminateAtTaskOverload = $TERMINATE_AT_TASK_OVERLOAD$;
 const bool SimulinkInterface::terminateAtCPUOverload = $TERMINATE_AT_CPU_OVERLOAD$;
+const double SimulinkInterface::watchdogTimeoutFactor = $WATCHDOG_TIMEOUT_FACTOR$;
+const bool SimulinkInterface::watchdogTerminate = $WATCHDOG_TERMINATE$;
+const bool SimulinkInterface::loadShedding = $LOAD_SHEDDING$;
+const uint32_t SimulinkInterface::loadSheddingFactor = $LOAD_SHEDDING_FACTOR$;
 const uint32_t SimulinkInterface::numberOfOldProtocolFiles = $NUMBER_OF_OLD_PROTOCOL_FILES$;
+const uint64_t SimulinkInterface::cpuAffinity[] = {$ARRAY_CPU_AFFINITY$};
+const uint64_t SimulinkInterface::cpuAffinityBaseRateScheduler = $CPU_AFFINITY_BASE_RATE_SCHEDULER$;
+const uint64_t SimulinkInterface::cpuAffinityDataRecorder = $CPU_AFFINITY_DATA_RECORDER$;
+const uint64_t SimulinkInterface::cpuAffinityNetwork = $CPU_AFFINITY_NETWORK$;
+const uint32_t SimulinkInterface::overrunPolicies[] = {$ARRAY_OVERRUN_POLICIES$};
+const uint32_t SimulinkInterface::activationQueueSizes[] = {$ARRAY_ACTIVATION_QUEUE_SIZES$};
+const bool SimulinkInterface::inlineExecution = $INLINE_EXECUTION$;
+const double SimulinkInterface::inlineExecutionTimeThreshold = $INLINE_EXECUTION_TIME_THRESHOLD$;
+const uint32_t SimulinkInterface::workerPoolSize = $WORKER_POOL_SIZE$;
+const uint64_t SimulinkInterface::cpuAffinityWorkerPool = $CPU_AFFINITY_WORKER_POOL$;
+const double SimulinkInterface::executionTimeBudgets[] = {$ARRAY_EXECUTION_TIME_BUDGETS$};
+const bool SimulinkInterface::sheddable[] = {$ARRAY_SHEDDABLE$};
+const uint32_t SimulinkInterface::schedulingPolicy = $SCHEDULING_POLICY$;
+const double SimulinkInterface::deadlineRuntimeMargin = $DEADLINE_RUNTIME_MARGIN$;
+const bool SimulinkInterface::measureResourceUsage = $MEASURE_RESOURCE_USAGE$;
+const uint32_t SimulinkInterface::traceBufferSize = $TRACE_BUFFER_SIZE$;
+const bool SimulinkInterface::lockMemory = $LOCK_MEMORY$;
+const uint32_t SimulinkInterface::heapReserveSize = $HEAP_RESERVE_SIZE$;
+const uint32_t SimulinkInterface::stackPrefaultSize = $STACK_PREFAULT_SIZE$;
+const uint32_t SimulinkInterface::timerMode = $TIMER_MODE$;
+const double SimulinkInterface::timerSpinTime = $TIMER_SPIN_TIME$;
+const uint32_t SimulinkInterface::timerAlignment = $TIMER_ALIGNMENT$;
+const double SimulinkInterface::timerPhaseOffset = $TIMER_PHASE_OFFSET$;
+const uint32_t SimulinkInterface::tickSyncMode = $TICK_SYNC_MODE$;
+const uint8_t SimulinkInterface::tickSyncGroup[] = {$ARRAY_TICK_SYNC_GROUP$};
+const uint16_t SimulinkInterface::tickSyncPort = $TICK_SYNC_PORT$;
+const uint8_t SimulinkInterface::tickSyncInterface[] = {$ARRAY_TICK_SYNC_INTERFACE$};
+const uint32_t SimulinkInterface::tickSyncInterval = $TICK_SYNC_INTERVAL$;
+const double SimulinkInterface::tickSyncLatency = $TICK_SYNC_LATENCY$;
 
 
 void SimulinkInterface::Initialize(void){
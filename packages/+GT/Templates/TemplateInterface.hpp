@@ -15,13 +15,52 @@ class SimulinkInterface {
         static const std::string modelName;                                 ///< A string indicating the model name (ASCII characters only).
         static const uint16_t portAppSocket;                                ///< The port for the application socket.
         static const int32_t priorityDataRecorder;                          ///< Priority for data recording threads.
+        static const double dataRecorderBufferTime;                         ///< Time window in seconds for which the buffer of each data recorder is preallocated, assuming one sample per base-rate tick.
+        static const uint32_t numDataRecorderThreads;                       ///< Number of data recording threads that write the data files of all data recorders.
+        static const uint32_t dataRecorderBlockSize;                        ///< Size in bytes of the blocks in which data files are written (a multiple of 4096).
+        static const bool dataRecorderDirectIO;                             ///< True if data files are preallocated and written with O_DIRECT (Linux only), false otherwise.
         static const double baseSampleTime;                                 ///< The base sample time in seconds.
         static const int32_t sampleTicks[SIMULINK_INTERFACE_NUM_TIMINGS];   ///< Sample time scaler for model step. Sample time for model step [i] is baseSampleTime * sampleTicks[i].
+        static const uint32_t sampleOffsetTicks[SIMULINK_INTERFACE_NUM_TIMINGS]; ///< Sample offset for model step in ticks of the base sample time. Model step [i] is executed at all ticks with (tick mod sampleTicks[i]) == sampleOffsetTicks[i].
+        static const bool autoSampleOffsets;                                ///< True if sample offsets of slower model steps should be tuned automatically based on measured execution times.
         static const int32_t priorities[SIMULINK_INTERFACE_NUM_TIMINGS];    ///< Thread priorities for all model step functions.
         static const char* taskNames[SIMULINK_INTERFACE_NUM_TIMINGS];       ///< Names for all sample rate tasks.
         static const bool terminateAtTaskOverload;                          ///< True if application should be terminated at a task overload, false otherwise.
         static const bool terminateAtCPUOverload;                           ///< True if application should be terminated at a CPU overload, false otherwise.
+        static const double watchdogTimeoutFactor;                          ///< A step that runs longer than this multiple of its sampletime is reported by the watchdog (zero disables the watchdog).
+        static const bool watchdogTerminate;                                ///< True if the application should terminate if the watchdog detects a hung step.
+        static const bool loadShedding;                                     ///< True if sheddable rates should be slowed down and data recorders throttled under sustained overload.
+        static const uint32_t loadSheddingFactor;                           ///< Factor by which sheddable sampletimes are stretched and data recorders are decimated during load shedding.
         static const uint32_t numberOfOldProtocolFiles;                     ///< The number of old protocol files to keep when redirecting the output to protocol text files.
+        static const uint64_t cpuAffinity[SIMULINK_INTERFACE_NUM_TIMINGS];  ///< CPU core bitmasks for the threads of all model step functions (bit n indicates CPU core n, zero indicates no restriction).
+        static const uint64_t cpuAffinityBaseRateScheduler;                 ///< CPU core bitmask for the base-rate scheduler thread (zero indicates no restriction).
+        static const uint64_t cpuAffinityDataRecorder;                      ///< CPU core bitmask for data recording threads (zero indicates no restriction).
+        static const uint64_t cpuAffinityNetwork;                           ///< CPU core bitmask for UDP receiver threads (zero indicates no restriction).
+        static const uint32_t overrunPolicies[SIMULINK_INTERFACE_NUM_TIMINGS]; ///< Overrun policies for all model step functions: 0 (skip), 1 (queue) or 2 (restart-aligned).
+        static const uint32_t activationQueueSizes[SIMULINK_INTERFACE_NUM_TIMINGS]; ///< Maximum number of pending activations for all model step functions (only used for overrun policy 1).
+        static const bool inlineExecution;                                  ///< True if the base-rate scheduler executes the step functions directly instead of notifying the task threads.
+        static const double inlineExecutionTimeThreshold;                   ///< Execution time in seconds above which a task falls back from inline execution to its own thread.
+        static const uint32_t workerPoolSize;                               ///< Number of worker threads that execute the steps of all tasks (zero indicates one thread per task).
+        static const double executionTimeBudgets[SIMULINK_INTERFACE_NUM_TIMINGS]; ///< Execution time budgets in seconds for all model step functions, steps that take longer are counted as over budget.
+        static const bool sheddable[SIMULINK_INTERFACE_NUM_TIMINGS];        ///< True for all model step functions whose rate may be slowed down by the load shedding.
+        static const uint32_t schedulingPolicy;                             ///< Scheduling policy of the task threads: 0 (SCHED_FIFO) or 1 (SCHED_DEADLINE with fallback to SCHED_FIFO).
+        static const double deadlineRuntimeMargin;                          ///< Factor applied to the maximum measured execution time to obtain the SCHED_DEADLINE runtime budget (only used for schedulingPolicy 1).
+        static const bool measureResourceUsage;                             ///< True if context switches and page faults of the task threads are counted for each step (getrusage), false otherwise.
+        static const uint32_t traceBufferSize;                              ///< Number of trace records per thread (rounded up to a power of two), zero disables tracing.
+        static const bool lockMemory;                                       ///< True if memory should be locked (mlockall), the heap pre-reserved and the stacks of realtime threads prefaulted.
+        static const uint32_t heapReserveSize;                              ///< Number of bytes to be reserved and prefaulted on the heap if memory is locked.
+        static const uint32_t stackPrefaultSize;                            ///< Number of bytes to be prefaulted on the stack of each realtime thread if memory is locked.
+        static const uint64_t cpuAffinityWorkerPool;                        ///< CPU core bitmask for the worker pool, worker k is pinned to the k-th core of this bitmask (zero indicates no restriction).
+        static const uint32_t timerMode;                                    ///< Backend of the master clock: 0 (timerfd) or 1 (absolute deadlines using clock_nanosleep).
+        static const double timerSpinTime;                                  ///< Time in seconds before each deadline during which the master thread busy-spins (only used for timerMode 1).
+        static const uint32_t timerAlignment;                               ///< Reference clock to which the master clock is phase-aligned: 0 (none), 1 (CLOCK_REALTIME) or 2 (CLOCK_TAI).
+        static const double timerPhaseOffset;                               ///< Offset in seconds of the first tick of the master clock to the full second of the reference clock (only used if timerAlignment is not 0).
+        static const uint32_t tickSyncMode;                                 ///< Role in the tick synchronization: 0 (none), 1 (master) or 2 (slave).
+        static const uint8_t tickSyncGroup[4];                              ///< IPv4 address of the multicast group for sync beacons.
+        static const uint16_t tickSyncPort;                                 ///< Port for sync beacons.
+        static const uint8_t tickSyncInterface[4];                          ///< IPv4 address of the interface via which sync beacons are sent and received ({0,0,0,0} for the default interface).
+        static const uint32_t tickSyncInterval;                             ///< Number of base-rate ticks between two sync beacons of the master.
+        static const double tickSyncLatency;                                ///< Known network latency in seconds from the master to this slave.
 
         static $NAME_OF_CLASS$ model;
 
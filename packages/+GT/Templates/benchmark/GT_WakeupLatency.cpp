@@ -0,0 +1,132 @@
+/**
+ * @brief Micro-benchmark of the notify-to-wake latency of the task wakeup path.
+ * @details Compares the mutex and condition variable pair that has previously been used by the periodic tasks and events with the lock-free
+ * @ref gt::WakeupSignal. A notifier thread notifies a waiting thread in fixed intervals. For each wakeup, the benchmark measures the time the
+ * notifier spends inside the notify call and the time from the start of the notify call until the waiting thread is running again.
+ * This file is not part of the generated target application. Build and run it on the target hardware as follows (run as root to obtain
+ * realtime priorities, use taskset to pin both threads to isolated CPU cores):
+ *
+ *   cd packages/+GT/Templates
+ *   g++ -std=c++20 -O2 -Icode benchmark/GT_WakeupLatency.cpp code/GenericTarget/GT_WakeupSignal.cpp -o GT_WakeupLatency -lpthread
+ *   sudo ./GT_WakeupLatency [numWakeups] [intervalUs]
+ */
+#include <GenericTarget/GT_WakeupSignal.hpp>
+
+
+/**
+ * @brief The previous wakeup path: a mutex protected flag and a condition variable.
+ */
+class MutexSignal {
+    public:
+        MutexSignal(): notified(false){}
+
+        inline void Notify(void){
+            std::unique_lock<std::mutex> lock(mtx);
+            notified = true;
+            cv.notify_one();
+        }
+
+        inline void Wait(void){
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this](){ return this->notified; });
+            notified = false;
+        }
+
+    private:
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool notified;
+};
+
+
+/**
+ * @brief The previous event path: like @ref MutexSignal but the notifier yields after each notification.
+ */
+class YieldingMutexSignal: public MutexSignal {
+    public:
+        inline void Notify(void){
+            MutexSignal::Notify();
+            std::this_thread::yield();
+        }
+};
+
+
+/**
+ * @brief Set a realtime priority for the calling thread. Failures are ignored, the benchmark then runs with the default priority.
+ * @param [in] priority The SCHED_FIFO priority.
+ */
+static void SetRealtimePriority(int priority){
+    struct sched_param param;
+    param.sched_priority = priority;
+    (void) pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+}
+
+
+/**
+ * @brief Print a summary of the given latencies.
+ * @param [in] name The name of the latency.
+ * @param [in] values The latencies in nanoseconds, will be sorted.
+ */
+static void PrintSummary(const char* name, std::vector<int64_t>& values){
+    std::sort(values.begin(), values.end());
+    double mean = std::accumulate(values.begin(), values.end(), 0.0) / double(values.size());
+    auto percentile = [&values](double p){ return 1e-3 * double(values[std::min(values.size() - 1, size_t(p * 0.01 * double(values.size())))]); };
+    printf("  %-16s min=%8.3lf us, mean=%8.3lf us, p50=%8.3lf us, p99=%8.3lf us, p99.9=%8.3lf us, max=%8.3lf us\n", name, 1e-3 * double(values.front()), 1e-3 * mean, percentile(50.0), percentile(99.0), percentile(99.9), 1e-3 * double(values.back()));
+}
+
+
+/**
+ * @brief Run the benchmark for one signal type.
+ * @param [in] name The name of the signal type.
+ * @param [in] numWakeups Number of wakeups to be measured.
+ * @param [in] intervalUs Interval between two notifications in microseconds. The notifier waits until the previous wakeup has been acknowledged
+ * and then sleeps for this interval, so the waiting thread is blocked before each notification.
+ */
+template <class T> static void Run(const char* name, size_t numWakeups, int64_t intervalUs){
+    T signal;
+    std::atomic<int64_t> notifyTime(0);
+    std::atomic<size_t> numAcknowledged(0);
+    std::vector<int64_t> notifyDurations(numWakeups);
+    std::vector<int64_t> wakeLatencies(numWakeups);
+    auto now = [](){ return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); };
+
+    std::thread waiter([&](){
+        SetRealtimePriority(98);
+        for(size_t n = 0; n < numWakeups; ++n){
+            signal.Wait();
+            wakeLatencies[n] = now() - notifyTime.load(std::memory_order_acquire);
+            numAcknowledged.store(n + 1, std::memory_order_release);
+        }
+    });
+    std::thread notifier([&](){
+        SetRealtimePriority(99);
+        for(size_t n = 0; n < numWakeups; ++n){
+            while(numAcknowledged.load(std::memory_order_acquire) < n){
+                std::this_thread::sleep_for(std::chrono::microseconds(10));
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(intervalUs));
+            int64_t t0 = now();
+            notifyTime.store(t0, std::memory_order_release);
+            signal.Notify();
+            notifyDurations[n] = now() - t0;
+        }
+    });
+    notifier.join();
+    waiter.join();
+
+    printf("%s\n", name);
+    PrintSummary("notify call", notifyDurations);
+    PrintSummary("notify-to-wake", wakeLatencies);
+}
+
+
+int main(int argc, char** argv){
+    size_t numWakeups = (argc > 1) ? size_t(std::strtoull(argv[1], nullptr, 10)) : 100000;
+    int64_t intervalUs = (argc > 2) ? int64_t(std::strtoll(argv[2], nullptr, 10)) : 100;
+    printf("numWakeups=%lu, intervalUs=%ld\n", numWakeups, intervalUs);
+    Run<MutexSignal>("std::mutex + std::condition_variable (previous PeriodicTask)", numWakeups, intervalUs);
+    Run<YieldingMutexSignal>("std::mutex + std::condition_variable + yield (previous Event)", numWakeups, intervalUs);
+    Run<gt::WakeupSignal>("gt::WakeupSignal", numWakeups, intervalUs);
+    return 0;
+}
+
@@ -0,0 +1,284 @@
+#include <GenericTarget/DataRecorder/GT_DataRecorderBase.hpp>
+#include <GenericTarget/GT_GenericTarget.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
+using namespace gt;
+
+
+DataRecorderBase::DataRecorderBase(){
+    notifyThreshold = 1;
+    numDroppedSamples = 0;
+    wakeupSignal = nullptr;
+    waitWhenFull = false;
+    filename = "";
+    numSamplesPerFile = 0;
+    currentFileNumber = 0;
+    currentFileFD = -1;
+    numSamplesInFile = 0;
+    numHeaderBytesCopied = 0;
+    numSampleBytesCopied = 0;
+    block = nullptr;
+    blockSize = 0;
+    blockFill = 0;
+    blockOffset = 0;
+    fileLength = 0;
+    droppedReported = false;
+}
+
+DataRecorderBase::~DataRecorderBase(){
+    CloseDataFile();
+    FreeBlock();
+}
+
+bool DataRecorderBase::PrepareAppend(DataRecorderAppend& append, bool final){
+    if(!block){
+        return false;
+    }
+
+    // Start a new data file as soon as there're samples for it
+    if(currentFileFD < 0){
+        if(!ring.Size() || !OpenDataFile()){
+            return false;
+        }
+    }
+
+    // Append the block if it's full, the last block of a data file is appended if the data file is complete or if the recording is stopped
+    FillBlock();
+    if((blockOffset + blockFill) <= fileLength){
+        return false;
+    }
+    if((blockFill < blockSize) && !IsDataFileComplete() && !final){
+        return false;
+    }
+    append.fd = currentFileFD;
+    append.offset = blockOffset;
+    append.data = block;
+    append.numBytes = blockFill;
+
+    // Direct I/O requires aligned lengths, the padding is removed by truncating the data file when it is closed
+    if(SimulinkInterface::dataRecorderDirectIO && (blockFill % GENERIC_TARGET_DATA_RECORDER_ALIGNMENT)){
+        append.numBytes = std::min(blockSize, (blockFill / GENERIC_TARGET_DATA_RECORDER_ALIGNMENT + 1) * GENERIC_TARGET_DATA_RECORDER_ALIGNMENT);
+        std::memset(block + blockFill, 0, append.numBytes - blockFill);
+    }
+    return true;
+}
+
+void DataRecorderBase::FinishAppend(const DataRecorderAppend& append, bool success){
+    if(!success){
+        return;
+    }
+
+    // A block that is not full remains in the buffer and is written again at the same offset if more samples follow
+    fileLength = append.offset + blockFill;
+    if(blockFill == blockSize){
+        blockOffset += blockSize;
+        blockFill = 0;
+    }
+
+    // File has been finished successfully, the next data file is created for the next samples
+    if(IsDataFileComplete()){
+        CloseDataFile();
+        currentFileNumber++;
+    }
+}
+
+void DataRecorderBase::ReportDroppedSamples(void){
+    if(!droppedReported && numDroppedSamples.load(std::memory_order_relaxed)){
+        GENERIC_TARGET_PRINT_WARNING("The buffer of data recorder \"%s\" is full, samples are dropped! Consider increasing the dataRecorderBufferTime.\n", filename.c_str());
+        droppedReported = true;
+    }
+}
+
+bool DataRecorderBase::StartRecording(std::string filename, size_t numBytesPerSample, size_t numSamplesPerFile){
+    // Allocate the ring for the buffer time window (a data recorder writes at most one sample per base-rate tick)
+    size_t numSamples = static_cast<size_t>(std::ceil(SimulinkInterface::dataRecorderBufferTime / SimulinkInterface::baseSampleTime));
+    if(!ring.Allocate(numBytesPerSample, numSamples)){
+        GENERIC_TARGET_PRINT_ERROR("Could not allocate the buffer for %llu samples of data recorder \"%s\"!\n", (unsigned long long)numSamples, filename.c_str());
+        return false;
+    }
+
+    // Allocate the block buffer, all bytes are written such that the memory is prefaulted before recording starts
+    if(!AllocateBlock(SimulinkInterface::dataRecorderBlockSize)){
+        GENERIC_TARGET_PRINT_ERROR("Could not allocate the block buffer of data recorder \"%s\"!\n", filename.c_str());
+        ring.Free();
+        return false;
+    }
+    this->notifyThreshold = std::max(uint64_t(1), ring.GetCapacity() / 4);
+    this->waitWhenFull = GenericTarget::args.freeRun;
+    this->spaceSignal.Clear();
+    this->numDroppedSamples = 0;
+    this->droppedReported = false;
+    this->filename = filename;
+    this->numSamplesPerFile = numSamplesPerFile;
+    this->currentFileNumber = 0;
+    this->numSamplesInFile = 0;
+    this->numHeaderBytesCopied = 0;
+    this->numSampleBytesCopied = 0;
+    this->blockFill = 0;
+    this->blockOffset = 0;
+    this->fileLength = 0;
+    return true;
+}
+
+void DataRecorderBase::StopRecording(void){
+    if(ring.GetCapacity()){
+        std::string currentFileName = this->filename + std::string("_") + std::to_string(this->currentFileNumber);
+        uint64_t numSamples = ring.Size();
+        uint64_t numBytes = (blockOffset + blockFill) - std::min(blockOffset + blockFill, fileLength);
+        if(numSamples || numBytes){
+            GENERIC_TARGET_PRINT_WARNING("Some signal data is in the buffer (%llu samples, %llu bytes) but could not be written to the data file \"%s\"!\n", (unsigned long long)numSamples, (unsigned long long)numBytes, currentFileName.c_str());
+        }
+        if(uint64_t numDropped = numDroppedSamples.load()){
+            GENERIC_TARGET_PRINT_WARNING("%llu samples have been dropped because the buffer of data file \"%s\" was full!\n", (unsigned long long)numDropped, currentFileName.c_str());
+        }
+    }
+    CloseDataFile();
+    ring.Free();
+    FreeBlock();
+    std::vector<uint8_t>().swap(header);
+    this->currentFileNumber = 0;
+    this->numSamplesInFile = 0;
+    this->numHeaderBytesCopied = 0;
+    this->numSampleBytesCopied = 0;
+    this->blockFill = 0;
+    this->blockOffset = 0;
+    this->fileLength = 0;
+}
+
+bool DataRecorderBase::OpenDataFile(void){
+    std::filesystem::path absolutePath = GenericTarget::fileSystem.GetDataRecordDirectory();
+    absolutePath /= (this->filename + std::string("_") + std::to_string(this->currentFileNumber));
+    std::string currentFileName = absolutePath.string();
+    #ifdef _WIN32
+    currentFileFD = _open(currentFileName.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+    #else
+    const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+    currentFileFD = -1;
+    if(SimulinkInterface::dataRecorderDirectIO){
+        currentFileFD = open(currentFileName.c_str(), flags | O_DIRECT, 0666);
+        if(currentFileFD < 0){
+            GENERIC_TARGET_PRINT_WARNING("Could not open data file \"%s\" with O_DIRECT (%s), the page cache is used!\n", currentFileName.c_str(), strerror(errno));
+        }
+    }
+    if(currentFileFD < 0){
+        currentFileFD = open(currentFileName.c_str(), flags, 0666);
+    }
+    #endif
+    if(currentFileFD < 0){
+        return false;
+    }
+    GenerateHeader(header);
+    numSamplesInFile = 0;
+    numHeaderBytesCopied = 0;
+    numSampleBytesCopied = 0;
+    blockFill = 0;
+    blockOffset = 0;
+    fileLength = 0;
+
+    // Preallocate the expected size of the data file, such that no blocks are allocated by the file system while recording
+    #ifndef _WIN32
+    if(SimulinkInterface::dataRecorderDirectIO && numSamplesPerFile){
+        off_t expectedSize = static_cast<off_t>(header.size() + numSamplesPerFile * ring.GetSampleSize());
+        if(fallocate(currentFileFD, 0, 0, expectedSize)){
+            GENERIC_TARGET_PRINT_WARNING("Could not preallocate %lld bytes for data file \"%s\" (%s)!\n", (long long)expectedSize, currentFileName.c_str(), strerror(errno));
+        }
+    }
+    #endif
+    GENERIC_TARGET_PRINT("Created data recording file \"%s\"\n", currentFileName.c_str());
+    return true;
+}
+
+void DataRecorderBase::CloseDataFile(void){
+    if(currentFileFD >= 0){
+        #ifdef _WIN32
+        (void) _close(currentFileFD);
+        #else
+        // Remove the preallocated space and the padding of the last block
+        if(SimulinkInterface::dataRecorderDirectIO && ftruncate(currentFileFD, static_cast<off_t>(fileLength))){
+            GENERIC_TARGET_PRINT_WARNING("Could not truncate data file \"%s_%u\" to %llu bytes (%s)!\n", filename.c_str(), currentFileNumber, (unsigned long long)fileLength, strerror(errno));
+        }
+        (void) close(currentFileFD);
+        #endif
+    }
+    currentFileFD = -1;
+}
+
+bool DataRecorderBase::AllocateBlock(size_t size){
+    FreeBlock();
+    if(!size || (size % GENERIC_TARGET_DATA_RECORDER_ALIGNMENT)){
+        return false;
+    }
+    #ifdef _WIN32
+    block = static_cast<uint8_t*>(_aligned_malloc(size, GENERIC_TARGET_DATA_RECORDER_ALIGNMENT));
+    #else
+    block = static_cast<uint8_t*>(std::aligned_alloc(GENERIC_TARGET_DATA_RECORDER_ALIGNMENT, size));
+    #endif
+    if(!block){
+        return false;
+    }
+    std::memset(block, 0, size);
+    blockSize = size;
+    return true;
+}
+
+void DataRecorderBase::FreeBlock(void){
+    #ifdef _WIN32
+    _aligned_free(block);
+    #else
+    std::free(block);
+    #endif
+    block = nullptr;
+    blockSize = 0;
+}
+
+void DataRecorderBase::FillBlock(void){
+    // The header is copied first and may span several blocks
+    if(numHeaderBytesCopied < header.size()){
+        size_t numBytes = std::min(header.size() - numHeaderBytesCopied, blockSize - blockFill);
+        std::memcpy(&block[blockFill], &header[numHeaderBytesCopied], numBytes);
+        numHeaderBytesCopied += numBytes;
+        blockFill += numBytes;
+        if(numHeaderBytesCopied < header.size()){
+            return;
+        }
+    }
+
+    // Copy contiguous spans of samples, the read cursor of the ring is advanced as soon as a sample has been copied completely
+    const size_t sampleSize = ring.GetSampleSize();
+    while((blockFill < blockSize) && !IsDataFileComplete()){
+        const uint8_t* data;
+        size_t numSamples = ring.Peek(data, 0);
+        if(!numSamples){
+            break;
+        }
+        if(numSamplesPerFile){
+            numSamples = std::min(numSamples, numSamplesPerFile - numSamplesInFile);
+        }
+        size_t numBytes = std::min(numSamples * sampleSize - numSampleBytesCopied, blockSize - blockFill);
+        std::memcpy(&block[blockFill], data + numSampleBytesCopied, numBytes);
+        blockFill += numBytes;
+        numSampleBytesCopied += numBytes;
+        size_t numCompleted = numSampleBytesCopied / sampleSize;
+        numSampleBytesCopied %= sampleSize;
+        ring.Release(numCompleted);
+        numSamplesInFile += numCompleted;
+        if(waitWhenFull && numCompleted){
+            spaceSignal.Notify();
+        }
+    }
+}
+
+uint8_t* DataRecorderBase::WaitForSpace(void){
+    if(!waitWhenFull){
+        return nullptr;
+    }
+    uint8_t* sample;
+    while(!(sample = ring.Reserve())){
+        if(!wakeupSignal){
+            return nullptr;
+        }
+        wakeupSignal->Notify();
+        (void) spaceSignal.WaitFor(GENERIC_TARGET_DATA_RECORDER_FLUSH_INTERVAL_MS);
+    }
+    return sample;
+}
+
@@ -2,20 +2,85 @@
 
 
 #include <GenericTarget/GT_Common.hpp>
+#include <GenericTarget/GT_WakeupSignal.hpp>
+#include <GenericTarget/DataRecorder/GT_DataRecorderRing.hpp>
 
 
 namespace gt {
 
 
 /**
- * @brief This abstract class represents the basics of a data recorder.
+ * @brief An append of one block of a data file.
+ */
+struct DataRecorderAppend {
+    int fd;                                   ///< File descriptor of the data file.
+    uint64_t offset;                          ///< File offset in bytes at which the block is written (a multiple of the block size).
+    const uint8_t* data;                      ///< The bytes of the block, aligned to GENERIC_TARGET_DATA_RECORDER_ALIGNMENT bytes.
+    size_t numBytes;                          ///< Number of bytes to be written, the block size or less for the last block of a data file (padded to the alignment for direct I/O).
+};
+
+
+/**
+ * @brief This abstract class represents the basics of a data recorder. Samples are copied to a preallocated ring by the model step. The data files are
+ * written by the recording I/O engine of the data recorder manager. The engine moves the buffered samples from the ring to a block buffer, which holds
+ * the bytes of the current data file (header and samples) in blocks of dataRecorderBlockSize bytes. A block is appended by @ref PrepareAppend and
+ * @ref FinishAppend as soon as it is full. The last block of a data file is written when the data file is complete or when the recording is stopped.
+ * The current data file is kept open and is only closed when the next data file is started.
+ * @details If dataRecorderDirectIO is enabled, each data file is preallocated to its expected size and opened with O_DIRECT (Linux only). The last
+ * block of a data file is then padded to the alignment and the data file is truncated to its real length when it is closed.
  */
 class DataRecorderBase {
     public:
+        /**
+         * @brief Create a data recorder.
+         */
+        DataRecorderBase();
+
         /**
          * @brief A virtual destructor to destroy the data recorder object.
          */
-        virtual ~DataRecorderBase(){}
+        virtual ~DataRecorderBase();
+
+        /**
+         * @brief Check whether a sample should be dropped to throttle the data recorder.
+         * @param [in] decimation Only every decimation-th sample is recorded (one records all samples).
+         * @return True if the sample should be dropped, false if it should be recorded.
+         */
+        inline bool SkipSample(uint32_t decimation){
+            return (decimation > 1) && (0 != (sampleCounter.fetch_add(1, std::memory_order_relaxed) % decimation));
+        }
+
+        /**
+         * @brief Set the wakeup signal of the data recording thread that writes the data files of this data recorder.
+         * @param [in] wakeupSignal The wakeup signal that is notified as soon as the buffer is filled by a quarter or nullptr if no thread should be notified.
+         * @details This function must be called before samples are written.
+         */
+        inline void SetWakeupSignal(WakeupSignal* wakeupSignal){ this->wakeupSignal = wakeupSignal; }
+
+        /**
+         * @brief Move buffered samples to the block buffer and prepare the append of the block if it's full. A new data file is created if required.
+         * @param [out] append The append to be written.
+         * @param [in] final True if the last block should be appended even if it's not full, e.g. when the recording is stopped.
+         * @return True if an append has been prepared, false if no block is ready or if the data file could not be created.
+         * @details Only the data recording thread may call this function. Each prepared append must be finished by @ref FinishAppend before the next
+         * append is prepared.
+         */
+        bool PrepareAppend(DataRecorderAppend& append, bool final);
+
+        /**
+         * @brief Finish an append that has been prepared by @ref PrepareAppend.
+         * @param [in] append The append that has been prepared.
+         * @param [in] success True if all bytes of the append have been written, false otherwise. A block that has not been written is appended again.
+         * @details Only the data recording thread may call this function.
+         */
+        void FinishAppend(const DataRecorderAppend& append, bool success);
+
+        /**
+         * @brief Print a warning if samples have been dropped because the buffer was full. The warning is printed once per recording, the total number of
+         * dropped samples is reported when the data recorder is stopped.
+         * @details Only the data recording thread may call this function.
+         */
+        void ReportDroppedSamples(void);
 
         // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
         // Implement start and stop member functions for derived classes
@@ -44,6 +109,121 @@ class DataRecorderBase {
         virtual inline void SetLabels(std::string labels){ (void)labels; }
         virtual inline void SetDimensions(std::string dimensions){ (void)dimensions; }
         virtual inline void SetDataTypes(std::string dataTypes){ (void)dataTypes; }
+
+    protected:
+        /**
+         * @brief Start the recording by allocating the buffer for the buffer time window.
+         * @param [in] filename The filename of the data recording files without the file number.
+         * @param [in] numBytesPerSample Number of bytes per sample including the timestamp.
+         * @param [in] numSamplesPerFile The number of samples per file or zero if all samples should be written to one file.
+         * @return True if success, false otherwise.
+         */
+        bool StartRecording(std::string filename, size_t numBytesPerSample, size_t numSamplesPerFile);
+
+        /**
+         * @brief Stop the recording, close the current data file, report samples that could not be written and release the buffers.
+         * @details The buffers must have been written by the data recording thread before this function is called.
+         */
+        void StopRecording(void);
+
+        /**
+         * @brief Copy a sample to the buffer or drop it if the buffer is full.
+         * @param [in] timestamp The timestamp in seconds to which the data belongs to.
+         * @param [in] data The data of the sample (excluding timestamp).
+         * @param [in] numBytes Number of bytes of the data, the sum of the timestamp and the data must match the number of bytes per sample.
+         * @details This function neither allocates memory nor takes a lock. The data recording thread is notified only if the buffer is filled by a quarter,
+         * otherwise the buffer is written periodically. In free-run mode, a full buffer blocks the caller by @ref WaitForSpace instead of dropping the sample.
+         * This member function must only be called by one thread at a time.
+         */
+        inline void Record(double timestamp, const void* data, size_t numBytes){
+            uint8_t* sample = ring.Reserve();
+            if(!sample && !(sample = WaitForSpace())){
+                numDroppedSamples.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            std::memcpy(sample, &timestamp, 8);
+            std::memcpy(sample + 8, data, numBytes);
+            if((ring.Commit() >= notifyThreshold) && (ring.SizeProducer() >= notifyThreshold) && wakeupSignal){
+                wakeupSignal->Notify();
+            }
+        }
+
+        /**
+         * @brief Generate the header of a data file.
+         * @param [out] header The bytes of the header.
+         * @details This member function is called by the data recording thread whenever a new data file is started.
+         */
+        virtual void GenerateHeader(std::vector<uint8_t>& header) = 0;
+
+    private:
+        std::atomic<uint32_t> sampleCounter{0};   ///< Number of samples passed to @ref SkipSample.
+
+        /* Buffer, written by the model step and read by the data recording thread */
+        DataRecorderRing ring;                    ///< Ring of samples (timestamp followed by the data) to be written to file.
+        uint64_t notifyThreshold;                 ///< Number of samples in the @ref ring at which the data recording thread is notified.
+        std::atomic<uint64_t> numDroppedSamples;  ///< Number of samples that have been dropped because the @ref ring was full.
+        WakeupSignal* wakeupSignal;               ///< Wakeup signal of the data recording thread or nullptr if no thread should be notified.
+        bool waitWhenFull;                        ///< True if @ref Record waits for space in a full @ref ring instead of dropping the sample (free-run mode).
+        WakeupSignal spaceSignal;                 ///< Notified by the data recording thread whenever samples have been released from the @ref ring while @ref waitWhenFull is set.
+
+        /* Data files, only accessed by the data recording thread while recording */
+        std::string filename;                     ///< The filename that has been set by @ref StartRecording.
+        size_t numSamplesPerFile;                 ///< Number of samples per file. If this value is zero, all samples are written to a single file.
+        uint32_t currentFileNumber;               ///< The current filenumber.
+        int currentFileFD;                        ///< File descriptor of the current data file or a negative value if no data file is open.
+        size_t numSamplesInFile;                  ///< Number of samples of the current file that have been moved to the block buffer.
+        std::vector<uint8_t> header;              ///< Header of the current data file.
+        size_t numHeaderBytesCopied;              ///< Number of bytes of the @ref header that have been copied to the block buffer.
+        size_t numSampleBytesCopied;              ///< Number of bytes of the oldest sample in the @ref ring that have already been copied to the block buffer.
+        uint8_t* block;                           ///< Block buffer that holds the bytes of the current data file at @ref blockOffset, aligned to GENERIC_TARGET_DATA_RECORDER_ALIGNMENT bytes.
+        size_t blockSize;                         ///< Size of the @ref block in bytes or zero if the block buffer is not allocated.
+        size_t blockFill;                         ///< Number of bytes in the @ref block.
+        uint64_t blockOffset;                     ///< File offset of the @ref block, a multiple of the block size.
+        uint64_t fileLength;                      ///< Number of bytes of the current data file that have been written successfully.
+        bool droppedReported;                     ///< True if dropped samples have already been reported by @ref ReportDroppedSamples, false otherwise.
+
+        /**
+         * @brief Wait until the data recording thread has released samples from the full @ref ring and reserve a sample.
+         * @return Pointer to the reserved sample or nullptr if the sample should be dropped, i.e. if not in free-run mode or if there's no data recording thread.
+         * @details This is the slow path of @ref Record. In free-run mode, the virtual master clock is stalled until the data recording thread has made room,
+         * such that no samples are dropped and the data files are identical from run to run.
+         */
+        uint8_t* WaitForSpace(void);
+
+        /**
+         * @brief Create the next data file and keep it open.
+         * @return True if success, false otherwise.
+         */
+        bool OpenDataFile(void);
+
+        /**
+         * @brief Close the current data file. For direct I/O, the data file is truncated to the number of bytes that have been written successfully.
+         */
+        void CloseDataFile(void);
+
+        /**
+         * @brief Allocate the block buffer, aligned to GENERIC_TARGET_DATA_RECORDER_ALIGNMENT bytes.
+         * @param [in] size Size of the block buffer in bytes, must be a multiple of the alignment.
+         * @return True if success, false otherwise.
+         */
+        bool AllocateBlock(size_t size);
+
+        /**
+         * @brief Release the block buffer.
+         */
+        void FreeBlock(void);
+
+        /**
+         * @brief Move the header and buffered samples to the block buffer until the block is full or the current data file is complete.
+         * @details Samples that have been copied completely are released from the @ref ring. A sample may be split between two blocks.
+         */
+        void FillBlock(void);
+
+        /**
+         * @brief Check whether all samples of the current data file have been moved to the block buffer.
+         * @return True if the current data file is complete, false otherwise.
+         */
+        inline bool IsDataFileComplete(void) const { return numSamplesPerFile && (numSamplesInFile >= numSamplesPerFile); }
 };
 
 
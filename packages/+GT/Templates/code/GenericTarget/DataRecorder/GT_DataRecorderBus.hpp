@@ -39,7 +39,9 @@ class DataRecorderBus: public DataRecorderBase {
          * @param [in] timestamp The timestamp in seconds to which the data belongs to.
          * @param [in] bytes Array that contains the bytes to write.
          * @param [in] numBytes Number of bytes to write.
-         * @details This member function triggers the data recording thread that writes the data to the binary file.
+         * @details The sample is copied to a preallocated ring without any lock or allocation. If the ring is full, the sample is dropped. The data
+         * recording thread writes the ring to the binary file periodically or as soon as the ring is filled by a quarter. This member function must
+         * only be called by one thread at a time.
          */
         void Write(double timestamp, uint8_t* bytes, uint32_t numBytes);
 
@@ -106,47 +108,14 @@ class DataRecorderBus: public DataRecorderBase {
         std::string dimensions;            ///< Dimensions (string).
         std::string dataTypes;             ///< Data types (string).
         std::atomic<bool> started;         ///< True if @ref Start has already been called, false otherwise.
-        std::string filename;              ///< The filename that has been set during the @ref Start member function.
-
-        /* Internal thread-safe attributes if signal object has been started */
-        std::vector<uint8_t> buffer;       ///< Buffering of binary values to be written to file.
-        std::mutex mtxBuffer;              ///< Protect the @ref buffer.
-        std::thread threadDataRecorder;    ///< Data recorder thread instance.
-        std::mutex mtxNotify;              ///< Mutex for thread notification.
-        std::condition_variable cvNotify;  ///< Condition variable for thread notification.
-        bool notified;                     ///< Flag for thread notification.
-        std::atomic<bool> terminate;       ///< Flag for thread termination.
-        uint32_t currentFileNumber;        ///< The current filenumber.
-        size_t numSamplesWritten;          ///< Number of samples that have been written to the current file.
-        bool currentFileStarted;           ///< True if header for current file has been written successfully, false otherwise.
 
+    protected:
         /**
-         * @brief Write header data to a file.
-         * @param [in] name Absolute name of the file to be created.
-         * @return True if success, false otherwise.
-         * @details This member function is called during the @ref Start member function.
-         */
-        bool WriteHeader(std::string name);
-
-        /**
-         * @brief Notify the data recorder thread.
-         */
-        inline void Notify(void){
-            std::unique_lock<std::mutex> lock(mtxNotify);
-            notified = true;
-            cvNotify.notify_one();
-        }
-
-        /**
-         * @brief Data recorder thread function.
-         */
-        void ThreadDataRecorder(void);
-
-        /**
-         * @brief Write a buffer to one or several data files.
-         * @param [inout] bytes Reference to a buffer that should be written to file(s). Values that have been written to file(s) successfully are removed from the container.
+         * @brief Generate the header of a data file.
+         * @param [out] header The bytes of the header.
+         * @details This member function is called by the data recording thread whenever a new data file is started.
          */
-        void WriteBufferToDataFiles(std::vector<uint8_t>& bytes);
+        void GenerateHeader(std::vector<uint8_t>& header);
 };
 
 
@@ -0,0 +1,235 @@
+#include <GenericTarget/DataRecorder/GT_DataRecorderIO.hpp>
+#include <GenericTarget/GT_Trace.hpp>
+#include <GenericTarget/GT_GenericTarget.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
+using namespace gt;
+
+
+DataRecorderIO::DataRecorderIO(){
+    terminate = false;
+}
+
+DataRecorderIO::~DataRecorderIO(){
+    Stop();
+}
+
+bool DataRecorderIO::Start(const std::vector<DataRecorderBase*>& dataRecorders, uint32_t numThreads){
+    // Make sure that the engine is stopped
+    Stop();
+    numThreads = std::min(numThreads, static_cast<uint32_t>(dataRecorders.size()));
+    if(!numThreads){
+        return true;
+    }
+
+    // Create all writers and assign the data recorders before any thread is started
+    terminate = false;
+    for(uint32_t k = 0; k < numThreads; ++k){
+        writers.push_back(new Writer());
+    }
+    for(size_t n = 0; n < dataRecorders.size(); ++n){
+        Writer& writer = *writers[n % numThreads];
+        writer.dataRecorders.push_back(dataRecorders[n]);
+        dataRecorders[n]->SetWakeupSignal(&writer.wakeupSignal);
+    }
+    bool ioUring = true;
+    for(auto&& writer : writers){
+        writer->requests.reserve(writer->dataRecorders.size());
+        writer->numAppends = 0;
+        writer->numFailedAppends = 0;
+        writer->numBatches = 0;
+        writer->maxQueueDepth = 0;
+        writer->numBytes = 0;
+        writer->writeTimeNs = 0;
+        ioUring &= writer->ring.Create(static_cast<uint32_t>(writer->dataRecorders.size()));
+    }
+    timeOfStart = std::chrono::steady_clock::now();
+
+    // Start data recording threads
+    for(uint32_t k = 0; k < numThreads; ++k){
+        if(!writers[k]->thread.Start([this, k](){ WriterThread(k); }, std::string("gt-rec-io-") + std::to_string(k), SimulinkInterface::priorityDataRecorder, SimulinkInterface::cpuAffinityDataRecorder)){
+            GENERIC_TARGET_PRINT_ERROR("Could not start data recording thread %u\n", k);
+            Stop();
+            return false;
+        }
+    }
+    GENERIC_TARGET_PRINT("Data recording I/O started (threads=%u, backend=%s)\n", numThreads, ioUring ? "io_uring" : "pwritev");
+    return true;
+}
+
+void DataRecorderIO::Stop(void){
+    if(writers.empty()){
+        return;
+    }
+
+    // Stop all data recording threads and write the remaining samples
+    terminate = true;
+    for(auto&& writer : writers){
+        writer->wakeupSignal.Notify();
+    }
+    for(auto&& writer : writers){
+        writer->thread.Join();
+    }
+    for(auto&& writer : writers){
+        Flush(*writer, true);
+    }
+
+    // Print statistics and delete writers
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - timeOfStart).count();
+    GENERIC_TARGET_PRINT("Data recording I/O has been stopped\n");
+    for(uint32_t k = 0; k < (uint32_t)writers.size(); ++k){
+        const Writer& w = *writers[k];
+        double megabytes = 1e-6 * double(w.numBytes);
+        double meanQueueDepth = w.numBatches ? (double(w.numAppends + w.numFailedAppends) / double(w.numBatches)) : 0.0;
+        double averageRate = (elapsed > 0) ? (megabytes / (1e-9 * double(elapsed))) : 0.0;
+        double writeRate = w.writeTimeNs ? (megabytes / (1e-9 * double(w.writeTimeNs))) : 0.0;
+        GENERIC_TARGET_PRINT("  thread %u: backend=%s, recorders=%lu, appends=%lu, failed=%lu, queue depth mean=%.2lf max=%lu, written=%.3lf MB, %.3lf MB/s (average), %.3lf MB/s (while writing)\n", k, w.ring.IsCreated() ? "io_uring" : "pwritev", (unsigned long)w.dataRecorders.size(), (unsigned long)w.numAppends, (unsigned long)w.numFailedAppends, meanQueueDepth, (unsigned long)w.maxQueueDepth, megabytes, averageRate, writeRate);
+    }
+    for(auto&& writer : writers){
+        for(auto&& dataRecorder : writer->dataRecorders){
+            dataRecorder->SetWakeupSignal(nullptr);
+        }
+        delete writer;
+    }
+    writers.clear();
+    terminate = false;
+}
+
+void DataRecorderIO::WriterThread(uint32_t writerID){
+    Writer& self = *writers[writerID];
+    Trace::RegisterThread("recorder io " + std::to_string(writerID));
+    while(!terminate){
+        // Wait for notification or write the buffers periodically
+        (void) self.wakeupSignal.WaitFor(GENERIC_TARGET_DATA_RECORDER_FLUSH_INTERVAL_MS);
+        if(terminate){
+            break;
+        }
+        Flush(self, false);
+
+        // Report the first dropped samples, the total number is reported when a data recorder is stopped
+        for(auto&& dataRecorder : self.dataRecorders){
+            dataRecorder->ReportDroppedSamples();
+        }
+    }
+    Trace::UnregisterThread();
+}
+
+void DataRecorderIO::Flush(Writer& writer, bool final){
+    for(;;){
+        // Prepare one append per data recorder, the next append of a data recorder is prepared after the previous one has been completed
+        writer.requests.clear();
+        for(auto&& dataRecorder : writer.dataRecorders){
+            Request request;
+            request.dataRecorder = dataRecorder;
+            request.success = false;
+            if(dataRecorder->PrepareAppend(request.append, final)){
+                writer.requests.push_back(request);
+            }
+        }
+        if(writer.requests.empty()){
+            return;
+        }
+
+        // Write the batch and finish all appends, blocks of failed appends remain in the buffer and are written at the next wakeup
+        bool success = true;
+        {
+            const TraceScope trace(trace_event::RECORDER_FLUSH, static_cast<uint32_t>(writer.requests.size()));
+            auto t0 = std::chrono::steady_clock::now();
+            WriteBatch(writer);
+            writer.writeTimeNs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0).count());
+        }
+        writer.numBatches++;
+        writer.maxQueueDepth = std::max(writer.maxQueueDepth, static_cast<uint64_t>(writer.requests.size()));
+        for(auto&& request : writer.requests){
+            request.dataRecorder->FinishAppend(request.append, request.success);
+            if(request.success){
+                writer.numAppends++;
+                writer.numBytes += request.append.numBytes;
+            }
+            else{
+                writer.numFailedAppends++;
+                success = false;
+            }
+        }
+        if(!success){
+            return;
+        }
+    }
+}
+
+void DataRecorderIO::WriteBatch(Writer& writer){
+    size_t numRequests = writer.requests.size();
+    size_t first = 0;
+    #ifndef _WIN32
+    // Submit the requests in chunks of the submission queue size and wait for all completions of a chunk
+    while(writer.ring.IsCreated() && (first < numRequests)){
+        uint32_t numPrepared = 0;
+        for(size_t n = first; (n < numRequests) && (numPrepared < writer.ring.GetNumEntries()); ++n, ++numPrepared){
+            Request& request = writer.requests[n];
+            request.iov.iov_base = const_cast<uint8_t*>(request.append.data);
+            request.iov.iov_len = request.append.numBytes;
+            if(!writer.ring.PrepareWritev(request.append.fd, &request.iov, 1, request.append.offset, static_cast<uint64_t>(n))){
+                break;
+            }
+        }
+        uint32_t numSubmitted = writer.ring.Submit();
+        if(!numSubmitted || !writer.ring.Wait(numSubmitted)){
+            // The io_uring instance is not usable, remaining requests are written synchronously
+            GENERIC_TARGET_PRINT_WARNING("Could not submit data recording appends via io_uring (%s), falling back to pwritev!\n", strerror(errno));
+            writer.ring.Destroy();
+            break;
+        }
+        uint64_t userData;
+        int32_t result;
+        for(uint32_t k = 0; (k < numSubmitted) && writer.ring.PopCompletion(userData, result); ++k){
+            Request& request = writer.requests[userData];
+            request.success = (result >= 0) && (static_cast<size_t>(result) == request.append.numBytes);
+        }
+        first += numSubmitted;
+    }
+    #endif
+
+    // Fallback: write remaining requests one after the other
+    for(size_t n = first; n < numRequests; ++n){
+        writer.requests[n].success = WriteAppend(writer.requests[n].append);
+    }
+}
+
+bool DataRecorderIO::WriteAppend(const DataRecorderAppend& append){
+    #ifdef _WIN32
+    if(_lseeki64(append.fd, static_cast<__int64>(append.offset), SEEK_SET) < 0){
+        return false;
+    }
+    const uint8_t* data = append.data;
+    size_t numBytes = append.numBytes;
+    while(numBytes){
+        int result = _write(append.fd, data, static_cast<unsigned int>(std::min(numBytes, size_t(0x40000000))));
+        if(result <= 0){
+            return false;
+        }
+        data += result;
+        numBytes -= static_cast<size_t>(result);
+    }
+    return true;
+    #else
+    struct iovec iov;
+    iov.iov_base = const_cast<uint8_t*>(append.data);
+    iov.iov_len = append.numBytes;
+    uint64_t offset = append.offset;
+    while(iov.iov_len){
+        ssize_t result = pwritev(append.fd, &iov, 1, static_cast<off_t>(offset));
+        if((result < 0) && (EINTR == errno)){
+            continue;
+        }
+        if(result <= 0){
+            return false;
+        }
+
+        // Short writes are continued behind the bytes that have been written
+        offset += static_cast<uint64_t>(result);
+        iov.iov_base = static_cast<uint8_t*>(iov.iov_base) + result;
+        iov.iov_len -= static_cast<size_t>(result);
+    }
+    return true;
+    #endif
+}
+
@@ -0,0 +1,111 @@
+#pragma once
+
+
+#include <GenericTarget/DataRecorder/GT_DataRecorderBase.hpp>
+#include <GenericTarget/GT_RealTimeThread.hpp>
+#include <GenericTarget/GT_WakeupSignal.hpp>
+#include <GenericTarget/GT_IOUring.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief The recording I/O engine writes the data files of all data recorders with a small number of data recording threads instead of one thread
+ * per data recorder. Each data recorder is assigned to one thread. Whenever a thread wakes up, it moves the buffered samples of its data recorders
+ * to their block buffers, collects one append of a full block from each data recorder and submits all appends as one batch via io_uring. If io_uring
+ * is not available, the appends are written one after the other by pwritev. The appends of one data recorder are written in order, because the next
+ * append of a data recorder is prepared only after the previous one has been completed.
+ * @details The engine counts the number of appends per submission (queue depth) and the number of written bytes. Both are reported when the engine
+ * is stopped.
+ */
+class DataRecorderIO {
+    public:
+        /**
+         * @brief Create a recording I/O engine.
+         */
+        DataRecorderIO();
+
+        /**
+         * @brief Stop the recording I/O engine.
+         */
+        ~DataRecorderIO();
+
+        /**
+         * @brief Start the data recording threads.
+         * @param [in] dataRecorders All data recorders that have been started. Data recorder n is assigned to thread (n mod numThreads).
+         * @param [in] numThreads Number of data recording threads, limited to the number of data recorders.
+         * @return True if success, false otherwise.
+         */
+        bool Start(const std::vector<DataRecorderBase*>& dataRecorders, uint32_t numThreads);
+
+        /**
+         * @brief Stop the data recording threads, write all buffered samples and print the I/O statistics of all threads.
+         * @details This function has no effect if the engine has not been started. The data recorders must be stopped after this call.
+         */
+        void Stop(void);
+
+    private:
+        /**
+         * @brief Internal data of one append that is submitted by a data recording thread.
+         */
+        struct Request {
+            DataRecorderBase* dataRecorder;             ///< The data recorder that prepared the append.
+            DataRecorderAppend append;                  ///< The append to be written.
+            #ifndef _WIN32
+            struct iovec iov;                           ///< Buffer of the append.
+            #endif
+            bool success;                               ///< True if all bytes of the append have been written, false otherwise.
+        };
+
+        /**
+         * @brief Internal data of one data recording thread.
+         */
+        struct Writer {
+            RealTimeThread thread;                      ///< The data recording thread.
+            WakeupSignal wakeupSignal;                  ///< Wakes up the thread if the buffer of a data recorder is filling up or if the thread should be terminated.
+            std::vector<DataRecorderBase*> dataRecorders; ///< The data recorders whose data files are written by this thread.
+            std::vector<Request> requests;              ///< Requests of the current batch (capacity is reserved for all data recorders).
+            IOUring ring;                               ///< The io_uring instance of this thread (not created if io_uring is not supported).
+            uint64_t numAppends;                        ///< Number of appends that have been written successfully.
+            uint64_t numFailedAppends;                  ///< Number of appends that could not be written.
+            uint64_t numBatches;                        ///< Number of submitted batches.
+            uint64_t maxQueueDepth;                     ///< Maximum number of appends per batch.
+            uint64_t numBytes;                          ///< Number of bytes that have been written successfully.
+            uint64_t writeTimeNs;                       ///< Total time in nanoseconds the thread spent writing batches.
+        };
+        std::vector<Writer*> writers;                   ///< All data recording threads.
+        std::atomic<bool> terminate;                    ///< True if the data recording threads are to be terminated, false otherwise.
+        std::chrono::time_point<std::chrono::steady_clock> timeOfStart;   ///< Timepoint of @ref Start.
+
+        /**
+         * @brief Internal data recording thread function.
+         * @param [in] writerID The ID of the data recording thread.
+         */
+        void WriterThread(uint32_t writerID);
+
+        /**
+         * @brief Write batches of appends until all full blocks of the data recorders of a thread have been written or until an append failed.
+         * @param [in] writer The data recording thread.
+         * @param [in] final True if the last blocks should be written even if they're not full, e.g. when the engine is stopped.
+         */
+        void Flush(Writer& writer, bool final);
+
+        /**
+         * @brief Write all requests of the current batch of a thread.
+         * @param [in] writer The data recording thread.
+         * @details The success of each request is set. Requests are submitted via io_uring if available, otherwise they are written by @ref WriteAppend.
+         */
+        void WriteBatch(Writer& writer);
+
+        /**
+         * @brief Write an append synchronously.
+         * @param [in] append The append to be written.
+         * @return True if all bytes have been written, false otherwise.
+         */
+        static bool WriteAppend(const DataRecorderAppend& append);
+};
+
+
+} /* namespace: gt */
+
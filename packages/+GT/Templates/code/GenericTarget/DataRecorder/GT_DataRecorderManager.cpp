@@ -8,90 +8,99 @@ using namespace gt;
 
 DataRecorderManager::DataRecorderManager(){
     created = false;
+    decimation = 1;
 }
 
 DataRecorderManager::~DataRecorderManager(){
     DestroyAllDataRecorders();
 }
 
-void DataRecorderManager::RegisterScalarDoubles(const uint8_t* idCharacters, uint32_t numIDCharacters, const uint8_t* signalNames, uint32_t numCharacters, uint32_t numSignals, uint32_t numSamplesPerFile){
+int32_t DataRecorderManager::RegisterScalarDoubles(const uint8_t* idCharacters, uint32_t numIDCharacters, const uint8_t* signalNames, uint32_t numCharacters, uint32_t numSignals, uint32_t numSamplesPerFile){
     // Get ID, labels (only use printable characters)
     std::string signalLabels = ConvertToPrintableString(signalNames, numCharacters);
     std::string id = ConvertToPrintableString(idCharacters, numIDCharacters);
+    auto found = handles.find(id);
     if(created){
-        GENERIC_TARGET_PRINT_WARNING("Cannot register data recorder (id=\"%s\") because all data recorders have already been created and started!\n",id.c_str());
-        return;
+        // A data recorder that is already running is registered again if the model is restarted
+        if(found == handles.end()){
+            GENERIC_TARGET_PRINT_WARNING("Cannot register data recorder (id=\"%s\") because all data recorders have already been created and started!\n",id.c_str());
+            return -1;
+        }
+        return found->second;
     }
 
     // Check if this data recorder is already in the list
-    auto found = dataRecorders.find(id);
-    if(found != dataRecorders.end()){
+    if(found != handles.end()){
         // This data recorder (id) was already registered, update parameters
         GENERIC_TARGET_PRINT_WARNING("Data recorder with ID \"%s\" has already been registered! Parameters are updated!\n",id.c_str());
-        found->second->SetNumSamplesPerFile(numSamplesPerFile);
-        found->second->SetNumSignals(numSignals);
-        found->second->SetLabels(signalLabels);
-    }
-    else{
-        // This is a new data recorder (id), add it to the list
-        DataRecorderScalarDoubles* obj = new DataRecorderScalarDoubles();
+        DataRecorderBase* obj = dataRecorders[found->second].second;
         obj->SetNumSamplesPerFile(numSamplesPerFile);
         obj->SetNumSignals(numSignals);
         obj->SetLabels(signalLabels);
-        dataRecorders.insert(std::pair<std::string, DataRecorderBase*>(id, obj));
+        return found->second;
     }
+
+    // This is a new data recorder (id), add it to the list
+    DataRecorderScalarDoubles* obj = new DataRecorderScalarDoubles();
+    obj->SetNumSamplesPerFile(numSamplesPerFile);
+    obj->SetNumSignals(numSignals);
+    obj->SetLabels(signalLabels);
+    return AddDataRecorder(id, obj);
 }
 
-void DataRecorderManager::WriteScalarDoubles(const uint8_t* idCharacters, uint32_t numIDCharacters, double timestamp, double* values, uint32_t numValues){
-    std::string id = ConvertToPrintableString(idCharacters, numIDCharacters);
-    if(created){
-        auto found = dataRecorders.find(id);
-        if(found != dataRecorders.end()){
-            found->second->Write(timestamp, values, numValues);
+void DataRecorderManager::WriteScalarDoubles(int32_t handle, double timestamp, double* values, uint32_t numValues){
+    if(created && (handle >= 0) && (static_cast<size_t>(handle) < dataRecorders.size())){
+        DataRecorderBase* obj = dataRecorders[handle].second;
+        if(!obj->SkipSample(decimation)){
+            obj->Write(timestamp, values, numValues);
         }
     }
 }
 
-void DataRecorderManager::RegisterBus(const uint8_t* idCharacters, uint32_t numIDCharacters, uint32_t numSamplesPerFile, uint32_t numBytesPerSample, const uint8_t* signalNames, uint32_t strlenSignalNames, const uint8_t* dimensions, uint32_t strlenDimensions, const uint8_t* dataTypes, uint32_t strlenDataTypes){
+int32_t DataRecorderManager::RegisterBus(const uint8_t* idCharacters, uint32_t numIDCharacters, uint32_t numSamplesPerFile, uint32_t numBytesPerSample, const uint8_t* signalNames, uint32_t strlenSignalNames, const uint8_t* dimensions, uint32_t strlenDimensions, const uint8_t* dataTypes, uint32_t strlenDataTypes){
     // Get ID, labels, dimensions, datatypes (only use printable characters)
     std::string id = ConvertToPrintableString(idCharacters, numIDCharacters);
     std::string signalLabels = ConvertToPrintableString(signalNames, strlenSignalNames);
     std::string strDimensions = ConvertToPrintableString(dimensions, strlenDimensions);
     std::string strDataTypes = ConvertToPrintableString(dataTypes, strlenDataTypes);
+    auto found = handles.find(id);
     if(created){
-        GENERIC_TARGET_PRINT_WARNING("Cannot register data recorder (id=\"%s\") because all data recorders have already been created and started!\n",id.c_str());
-        return;
+        // A data recorder that is already running is registered again if the model is restarted
+        if(found == handles.end()){
+            GENERIC_TARGET_PRINT_WARNING("Cannot register data recorder (id=\"%s\") because all data recorders have already been created and started!\n",id.c_str());
+            return -1;
+        }
+        return found->second;
     }
 
     // Check if this signal object is already in the list
-    auto found = dataRecorders.find(id);
-    if(found != dataRecorders.end()){
+    if(found != handles.end()){
         // This data recorder (id) was already registered, update parameters
         GENERIC_TARGET_PRINT_WARNING("Data recorder with ID \"%s\" has already been registered! Parameters are updated!\n",id.c_str());
-        found->second->SetNumSamplesPerFile(numSamplesPerFile);
-        found->second->SetNumBytesPerSample(numBytesPerSample);
-        found->second->SetLabels(signalLabels);
-        found->second->SetDimensions(strDimensions);
-        found->second->SetDataTypes(strDataTypes);
-    }
-    else{
-        // This is a new data recorder (id), add it to the list
-        DataRecorderBus* obj = new DataRecorderBus();
+        DataRecorderBase* obj = dataRecorders[found->second].second;
         obj->SetNumSamplesPerFile(numSamplesPerFile);
         obj->SetNumBytesPerSample(numBytesPerSample);
         obj->SetLabels(signalLabels);
         obj->SetDimensions(strDimensions);
         obj->SetDataTypes(strDataTypes);
-        dataRecorders.insert(std::pair<std::string, DataRecorderBase*>(id, obj));
+        return found->second;
     }
+
+    // This is a new data recorder (id), add it to the list
+    DataRecorderBus* obj = new DataRecorderBus();
+    obj->SetNumSamplesPerFile(numSamplesPerFile);
+    obj->SetNumBytesPerSample(numBytesPerSample);
+    obj->SetLabels(signalLabels);
+    obj->SetDimensions(strDimensions);
+    obj->SetDataTypes(strDataTypes);
+    return AddDataRecorder(id, obj);
 }
 
-void DataRecorderManager::WriteBus(const uint8_t* idCharacters, uint32_t numIDCharacters, double timestamp, uint8_t* bytes, uint32_t numBytesPerSample){
-    std::string id = ConvertToPrintableString(idCharacters, numIDCharacters);
-    if(created){
-        auto found = dataRecorders.find(id);
-        if(found != dataRecorders.end()){
-            found->second->Write(timestamp, bytes, numBytesPerSample);
+void DataRecorderManager::WriteBus(int32_t handle, double timestamp, uint8_t* bytes, uint32_t numBytesPerSample){
+    if(created && (handle >= 0) && (static_cast<size_t>(handle) < dataRecorders.size())){
+        DataRecorderBase* obj = dataRecorders[handle].second;
+        if(!obj->SkipSample(decimation)){
+            obj->Write(timestamp, bytes, numBytesPerSample);
         }
     }
 }
@@ -112,17 +121,34 @@ bool DataRecorderManager::CreateAllDataRecorders(void){
             DestroyAllDataRecorders();
             return false;
         }
+        std::vector<DataRecorderBase*> objects;
+        for(auto&& p : dataRecorders){
+            objects.push_back(p.second);
+        }
+        if(!recordingIO.Start(objects, SimulinkInterface::numDataRecorderThreads)){
+            DestroyAllDataRecorders();
+            return false;
+        }
     }
     return (created = true);
 }
 
 void DataRecorderManager::DestroyAllDataRecorders(void){
+    created = false;
+    recordingIO.Stop();
     for(auto&& p : dataRecorders){
         p.second->Stop();
         delete p.second;
     }
     dataRecorders.clear();
-    created = false;
+    handles.clear();
+}
+
+int32_t DataRecorderManager::AddDataRecorder(std::string id, DataRecorderBase* obj){
+    int32_t handle = static_cast<int32_t>(dataRecorders.size());
+    dataRecorders.push_back(std::pair<std::string, DataRecorderBase*>(id, obj));
+    handles.insert(std::pair<std::string, int32_t>(id, handle));
+    return handle;
 }
 
 bool DataRecorderManager::WriteIndexFile(std::string filename, int32_t date_year, int32_t date_month, int32_t date_mday, int32_t date_hour, int32_t date_min, int32_t date_sec, int32_t date_msec){
@@ -218,11 +244,11 @@ bool DataRecorderManager::CreateDataRecordingDirectory(void){
     }
     GENERIC_TARGET_PRINT("Created data recording directory \"%s\"\n", GenericTarget::fileSystem.GetDataRecordDirectory().string().c_str());
 
-    // Write index file
+    // Write index file (a rotated directory is dated to its creation instead of the up time)
     std::string indexFileName = GenericTarget::fileSystem.GetDataRecordIndexFilename();
-    TimeInfo upTimeUTC = GenericTarget::targetTime.GetUpTimeUTC();
+    TimeInfo dateUTC = GenericTarget::fileSystem.GetNumDataRecordRotations() ? GenericTarget::targetTime.GetUTCTime() : GenericTarget::targetTime.GetUpTimeUTC();
     GENERIC_TARGET_PRINT("Creating data record index file \"%s\"\n", indexFileName.c_str());
-    if(!WriteIndexFile(indexFileName, 1900 + upTimeUTC.year, 1 + upTimeUTC.month, upTimeUTC.mday, upTimeUTC.hour, upTimeUTC.minute, upTimeUTC.second, upTimeUTC.nanoseconds / 1000000)){
+    if(!WriteIndexFile(indexFileName, 1900 + dateUTC.year, 1 + dateUTC.month, dateUTC.mday, dateUTC.hour, dateUTC.minute, dateUTC.second, dateUTC.nanoseconds / 1000000)){
         GENERIC_TARGET_PRINT_ERROR("Could not create data record index file \"%s\"\n", indexFileName.c_str());
         return false;
     }
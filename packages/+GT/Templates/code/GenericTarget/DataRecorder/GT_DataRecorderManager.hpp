@@ -2,6 +2,7 @@
 
 
 #include <GenericTarget/DataRecorder/GT_DataRecorderBase.hpp>
+#include <GenericTarget/DataRecorder/GT_DataRecorderIO.hpp>
 
 
 namespace gt {
@@ -34,20 +35,21 @@ class DataRecorderManager {
          * @param [in] numCharacters Number of characters in the signalNames array.
          * @param [in] numSignals Number of signals to record.
          * @param [in] numSamplesPerFile The number of samples per file or zero if all samples should be written to one file.
-         * @details All signals that are to be recorded must be registered before the GenericTarget creates and starts all data recorders.
+         * @return The handle of the data recorder or a negative value if the data recorder could not be registered.
+         * @details All signals that are to be recorded must be registered before the GenericTarget creates and starts all data recorders. The handle
+         * is to be stored by the caller and passed to @ref WriteScalarDoubles. Registering an ID again returns the same handle.
          */
-        void RegisterScalarDoubles(const uint8_t* idCharacters, uint32_t numIDCharacters, const uint8_t* signalNames, uint32_t numCharacters, uint32_t numSignals, uint32_t numSamplesPerFile);
+        int32_t RegisterScalarDoubles(const uint8_t* idCharacters, uint32_t numIDCharacters, const uint8_t* signalNames, uint32_t numCharacters, uint32_t numSignals, uint32_t numSamplesPerFile);
 
         /**
          * @brief Write scalar doubles to file.
-         * @param [in] idCharacters Characters representing the unique ID of the data record.
-         * @param [in] numIDCharacters Actual number of characters representing the unique ID.
-         * @param [in] time A timestamp associated with the data value.
+         * @param [in] handle The handle that has been returned by @ref RegisterScalarDoubles.
+         * @param [in] timestamp A timestamp associated with the data value.
          * @param [in] values Data values.
          * @param [in] numValues Number of values.
-         * @details This function has no effect if the data recorder manager has not been created. The actual file writing is done by a separate thread.
+         * @details This function has no effect if the data recorder manager has not been created or if the handle is invalid. The actual file writing is done by a separate thread.
          */
-        void WriteScalarDoubles(const uint8_t* idCharacters, uint32_t numIDCharacters, double timestamp, double* values, uint32_t numValues);
+        void WriteScalarDoubles(int32_t handle, double timestamp, double* values, uint32_t numValues);
 
         /**
          * @brief Register a new data recorder for complete bus objects.
@@ -61,20 +63,27 @@ class DataRecorderManager {
          * @param [in] strlenDimensions Number of characters in the dimensions array.
          * @param [in] dataTypes String representing all signal data types separated by comma.
          * @param [in] strlenDataTypes Number of characters in the dataTypes array.
-         * @details All signals that are to be recorded must be registered before the GenericTarget creates and starts all data recorders.
+         * @return The handle of the data recorder or a negative value if the data recorder could not be registered.
+         * @details All signals that are to be recorded must be registered before the GenericTarget creates and starts all data recorders. The handle
+         * is to be stored by the caller and passed to @ref WriteBus. Registering an ID again returns the same handle.
          */
-        void RegisterBus(const uint8_t* idCharacters, uint32_t numIDCharacters, uint32_t numSamplesPerFile, uint32_t numBytesPerSample, const uint8_t* signalNames, uint32_t strlenSignalNames, const uint8_t* dimensions, uint32_t strlenDimensions, const uint8_t* dataTypes, uint32_t strlenDataTypes);
+        int32_t RegisterBus(const uint8_t* idCharacters, uint32_t numIDCharacters, uint32_t numSamplesPerFile, uint32_t numBytesPerSample, const uint8_t* signalNames, uint32_t strlenSignalNames, const uint8_t* dimensions, uint32_t strlenDimensions, const uint8_t* dataTypes, uint32_t strlenDataTypes);
 
         /**
          * @brief Write bus signals to file.
-         * @param [in] idCharacters Characters representing the unique ID of the data record.
-         * @param [in] numIDCharacters Actual number of characters representing the unique ID.
+         * @param [in] handle The handle that has been returned by @ref RegisterBus.
          * @param [in] timestamp A time value associated with the data value.
          * @param [in] bytes Array containing the bytes for a sample (exluding timestamp).
          * @param [in] numBytesPerSample The number of bytes per sample (exluding timestamp).
-         * @details This function has no effect if the data recorder manager has not been created. The actual file writing is done by a separate thread.
+         * @details This function has no effect if the data recorder manager has not been created or if the handle is invalid. The actual file writing is done by a separate thread.
+         */
+        void WriteBus(int32_t handle, double timestamp, uint8_t* bytes, uint32_t numBytesPerSample);
+
+        /**
+         * @brief Throttle all data recorders.
+         * @param [in] decimation Only every decimation-th sample of each data recorder is written (one writes all samples).
          */
-        void WriteBus(const uint8_t* idCharacters, uint32_t numIDCharacters, double timestamp, uint8_t* bytes, uint32_t numBytesPerSample);
+        inline void SetDecimation(uint32_t decimation){ this->decimation = std::max(uint32_t(1), decimation); }
 
     protected:
         friend GenericTarget;
@@ -92,8 +101,19 @@ class DataRecorderManager {
 
     private:
         std::atomic<bool> created;                                         ///< True if data recorders have been successfully created by @ref CreateAllDataRecorders, false otherwise.
-        std::unordered_map<std::string, DataRecorderBase*> dataRecorders;  ///< List of all created data recorders.
+        std::atomic<uint32_t> decimation;                                  ///< Only every decimation-th sample of each data recorder is written.
+        std::vector<std::pair<std::string, DataRecorderBase*>> dataRecorders; ///< List of all created data recorders (ID and object), the index is the handle of a data recorder.
+        std::unordered_map<std::string, int32_t> handles;                  ///< Handles of all data recorders by their ID.
         std::string directoryDataRecord;                                   ///< Absolute path to the data recording directory. The directory is created by @ref CreateAllDataRecorders.
+        DataRecorderIO recordingIO;                                        ///< The recording I/O engine that writes the data files of all data recorders.
+
+        /**
+         * @brief Add a new data recorder to the list of data recorders.
+         * @param [in] id ID of the data recorder.
+         * @param [in] obj The data recorder object. The manager takes the ownership.
+         * @return The handle of the data recorder.
+         */
+        int32_t AddDataRecorder(std::string id, DataRecorderBase* obj);
 
         /**
          * @brief Generate the filename string for a given data file identifier.
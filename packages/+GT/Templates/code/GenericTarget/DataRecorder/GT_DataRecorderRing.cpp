@@ -0,0 +1,64 @@
+#include <GenericTarget/DataRecorder/GT_DataRecorderRing.hpp>
+using namespace gt;
+
+
+DataRecorderRing::DataRecorderRing(){
+    head = 0;
+    cachedTail = 0;
+    tail = 0;
+    cachedHead = 0;
+    sampleSize = 0;
+    capacity = 0;
+    mask = 0;
+}
+
+bool DataRecorderRing::Allocate(size_t sampleSize, size_t numSamples){
+    Free();
+    if(!sampleSize){
+        return false;
+    }
+    numSamples = std::bit_ceil(std::max(size_t(2), numSamples));
+    if(numSamples > (std::numeric_limits<size_t>::max() / sampleSize)){
+        return false;
+    }
+    try{
+        // Resizing writes all bytes, such that the memory is prefaulted before recording starts
+        memory.resize(numSamples * sampleSize);
+    }
+    catch(...){
+        return false;
+    }
+    this->sampleSize = sampleSize;
+    this->capacity = numSamples;
+    this->mask = numSamples - 1;
+    return true;
+}
+
+void DataRecorderRing::Free(void){
+    std::vector<uint8_t>().swap(memory);
+    head = 0;
+    cachedTail = 0;
+    tail = 0;
+    cachedHead = 0;
+    sampleSize = 0;
+    capacity = 0;
+    mask = 0;
+}
+
+size_t DataRecorderRing::Peek(const uint8_t*& data, size_t numSkip){
+    const uint64_t t = tail.load(std::memory_order_relaxed);
+    if(!capacity){
+        return 0;
+    }
+    if((cachedHead - t) <= numSkip){
+        cachedHead = head.load(std::memory_order_acquire);
+        if((cachedHead - t) <= numSkip){
+            return 0;
+        }
+    }
+    const uint64_t first = t + numSkip;
+    const uint64_t index = first & mask;
+    data = &memory[index * sampleSize];
+    return static_cast<size_t>(std::min(cachedHead - first, capacity - index));
+}
+
@@ -0,0 +1,133 @@
+#pragma once
+
+
+#include <GenericTarget/GT_Common.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief A single-producer/single-consumer ring of fixed-size samples with a fixed capacity. The memory of the ring is allocated and prefaulted
+ * once before recording starts. The producer (the model step that records a sample) and the consumer (the data recorder thread) only share the
+ * head and the tail index, which are placed on separate cache lines. Each side keeps a cached copy of the index of the other side, such that the
+ * shared cache lines are only touched if the cached value says that the ring is full or empty.
+ * @details Writing a sample is wait-free: the producer copies the sample into the slot returned by @ref Reserve and publishes it by @ref Commit.
+ * If the ring is full, @ref Reserve fails and the sample must be dropped. The consumer obtains contiguous spans of samples by @ref Peek and frees
+ * them by @ref Release after they have been written to the data file.
+ */
+class DataRecorderRing {
+    public:
+        /**
+         * @brief Create an empty ring without any memory. Samples cannot be written until @ref Allocate is called.
+         */
+        DataRecorderRing();
+
+        /**
+         * @brief Allocate the memory of the ring. All samples that are in the ring are removed.
+         * @param [in] sampleSize Number of bytes per sample.
+         * @param [in] numSamples Minimum number of samples that fit into the ring, rounded up to a power of two.
+         * @return True if success, false otherwise.
+         * @details Neither the producer nor the consumer may access the ring during this call.
+         */
+        bool Allocate(size_t sampleSize, size_t numSamples);
+
+        /**
+         * @brief Release the memory of the ring.
+         * @details Neither the producer nor the consumer may access the ring during this call.
+         */
+        void Free(void);
+
+        /**
+         * @brief Get the slot for the next sample. Only the producer may call this function.
+         * @return Pointer to @ref sampleSize bytes or nullptr if the ring is full.
+         * @details The sample is not visible to the consumer until @ref Commit is called.
+         */
+        inline uint8_t* Reserve(void){
+            const uint64_t h = head.load(std::memory_order_relaxed);
+            if((h - cachedTail) >= capacity){
+                cachedTail = tail.load(std::memory_order_acquire);
+                if((h - cachedTail) >= capacity){
+                    return nullptr;
+                }
+            }
+            return &memory[(h & mask) * sampleSize];
+        }
+
+        /**
+         * @brief Publish the sample that has been written to the slot returned by @ref Reserve. Only the producer may call this function.
+         * @return An upper bound of the number of samples in the ring.
+         */
+        inline uint64_t Commit(void){
+            const uint64_t h = head.load(std::memory_order_relaxed) + 1;
+            head.store(h, std::memory_order_release);
+            return h - cachedTail;
+        }
+
+        /**
+         * @brief Get the number of samples in the ring as seen by the producer. Only the producer may call this function.
+         * @return Number of samples in the ring.
+         */
+        inline uint64_t SizeProducer(void){
+            cachedTail = tail.load(std::memory_order_acquire);
+            return head.load(std::memory_order_relaxed) - cachedTail;
+        }
+
+        /**
+         * @brief Get a contiguous span of samples without removing them from the ring. Only the consumer may call this function.
+         * @param [out] data Pointer to the first sample of the span.
+         * @param [in] numSkip Number of oldest samples to be skipped, e.g. the number of samples of a span that has been obtained before.
+         * @return Number of samples in the span, zero if the ring does not contain more than numSkip samples.
+         * @details The span ends at the end of the memory of the ring. If the samples wrap around, the samples at the beginning of the memory are
+         * obtained by a second call that skips the first span.
+         */
+        size_t Peek(const uint8_t*& data, size_t numSkip);
+
+        /**
+         * @brief Remove the oldest samples from the ring. Only the consumer may call this function.
+         * @param [in] numSamples Number of samples to be removed, must not exceed the number of samples returned by @ref Peek.
+         */
+        inline void Release(size_t numSamples){
+            tail.store(tail.load(std::memory_order_relaxed) + numSamples, std::memory_order_release);
+        }
+
+        /**
+         * @brief Get the number of samples in the ring as seen by the consumer. Only the consumer may call this function.
+         * @return Number of samples in the ring.
+         */
+        inline uint64_t Size(void){
+            cachedHead = head.load(std::memory_order_acquire);
+            return cachedHead - tail.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Get the capacity of the ring.
+         * @return Maximum number of samples in the ring.
+         */
+        inline uint64_t GetCapacity(void) const { return capacity; }
+
+        /**
+         * @brief Get the size of a sample.
+         * @return Number of bytes per sample.
+         */
+        inline size_t GetSampleSize(void) const { return sampleSize; }
+
+    private:
+        /* Producer cache line */
+        alignas(GENERIC_TARGET_CACHE_LINE_SIZE) std::atomic<uint64_t> head;   ///< Total number of samples that have been committed by the producer.
+        uint64_t cachedTail;                                                  ///< The latest tail seen by the producer.
+
+        /* Consumer cache line */
+        alignas(GENERIC_TARGET_CACHE_LINE_SIZE) std::atomic<uint64_t> tail;   ///< Total number of samples that have been released by the consumer.
+        uint64_t cachedHead;                                                  ///< The latest head seen by the consumer.
+
+        /* Read-only while recording */
+        alignas(GENERIC_TARGET_CACHE_LINE_SIZE) std::vector<uint8_t> memory;  ///< Memory for all samples.
+        size_t sampleSize;                                                    ///< Number of bytes per sample.
+        uint64_t capacity;                                                    ///< Maximum number of samples in the ring (zero if no memory is allocated).
+        uint64_t mask;                                                        ///< Bitmask to obtain the index of a sample from the head or the tail.
+};
+
+
+} /* namespace: gt */
+
@@ -4,21 +4,38 @@ using namespace gt;
 
 ApplicationArguments::ApplicationArguments(){
     stop = false;
+    dumpTrace = false;
+    restart = false;
+    rotate = false;
     console = false;
+    freeRun = false;
+    stopTime = -1.0;
 }
 
 void ApplicationArguments::Parse(int argc, char** argv){
     // Set default values
     stop = false;
+    dumpTrace = false;
+    restart = false;
+    rotate = false;
     console = false;
+    freeRun = false;
+    stopTime = -1.0;
     bool help = false;
 
     // Scan all arguments, ignore unknown arguments
     for(int i = 1; i < argc; ++i){
         std::string arg(argv[i]);
         stop |= (0 == arg.compare("--stop"));
+        dumpTrace |= (0 == arg.compare("--dump-trace"));
+        restart |= (0 == arg.compare("--restart"));
+        rotate |= (0 == arg.compare("--restart-rotate"));
         console |= (0 == arg.compare("--console"));
         help |= (0 == arg.compare("--help"));
+        freeRun |= (0 == arg.compare("--free-run"));
+        if((0 == arg.compare("--stop-time")) && ((i + 1) < argc)){
+            stopTime = std::strtod(argv[++i], nullptr);
+        }
     }
 
     // Print help if requested
@@ -29,12 +46,17 @@ void ApplicationArguments::Parse(int argc, char** argv){
 
 void ApplicationArguments::PrintHelp(void){
     GENERIC_TARGET_PRINT_RAW("\n");
-    GENERIC_TARGET_PRINT_RAW("Syntax: GenericTarget [--console] [--help] [--stop]\n");
+    GENERIC_TARGET_PRINT_RAW("Syntax: GenericTarget [--console] [--dump-trace] [--free-run] [--help] [--restart] [--restart-rotate] [--stop] [--stop-time T]\n");
     GENERIC_TARGET_PRINT_RAW("\n");
     GENERIC_TARGET_PRINT_RAW("Options:\n");
-    GENERIC_TARGET_PRINT_RAW("    --console   Print stdout/stderr to the console instead of redirecting them to a protocol file.\n");
-    GENERIC_TARGET_PRINT_RAW("    --help      Show this help page.\n");
-    GENERIC_TARGET_PRINT_RAW("    --stop      Stop another possibly running target application and also stop this application.\n");
+    GENERIC_TARGET_PRINT_RAW("    --console         Print stdout/stderr to the console instead of redirecting them to a protocol file.\n");
+    GENERIC_TARGET_PRINT_RAW("    --dump-trace      Request another running target application to dump its trace and stop this application.\n");
+    GENERIC_TARGET_PRINT_RAW("    --free-run        Run the model as fast as possible with a virtual master clock. All tasks are executed in rate-monotonic order by one thread.\n");
+    GENERIC_TARGET_PRINT_RAW("    --help            Show this help page.\n");
+    GENERIC_TARGET_PRINT_RAW("    --restart         Restart the model of another running target application without restarting its process and stop this application.\n");
+    GENERIC_TARGET_PRINT_RAW("    --restart-rotate  Same as --restart, but the other application also starts a new data recording directory.\n");
+    GENERIC_TARGET_PRINT_RAW("    --stop            Stop another possibly running target application and also stop this application.\n");
+    GENERIC_TARGET_PRINT_RAW("    --stop-time       Terminate the application as soon as the model execution time reaches T seconds.\n");
     GENERIC_TARGET_PRINT_RAW("\n");
     GENERIC_TARGET_PRINT_RAW("\n");
 }
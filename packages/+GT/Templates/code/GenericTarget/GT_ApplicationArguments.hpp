@@ -10,7 +10,12 @@ namespace gt {
 class ApplicationArguments {
     public:
         bool stop;         ///< True if another possibly running generic target application should be stopped.
+        bool dumpTrace;    ///< True if another possibly running generic target application should dump its trace.
+        bool restart;      ///< True if another possibly running generic target application should restart its model.
+        bool rotate;       ///< True if another possibly running generic target application should also start a new data recording directory when restarting its model.
         bool console;      ///< True if prints should be displayed in the console instead of redirecting them to a protocol file.
+        bool freeRun;      ///< True if the model should run as fast as possible with a virtual master clock instead of the hardware timer.
+        double stopTime;   ///< Model execution time in seconds after which the application terminates or a negative value if the application runs until it is stopped.
 
         /**
          * @brief Construct a new application arguments object and set default values.
@@ -6,15 +6,29 @@ using namespace gt;
 
 BaseRateScheduler::BaseRateScheduler(){
     terminate = false;
+    freeRun = false;
+    virtualTime = 0.0;
 }
 
 void BaseRateScheduler::Start(void){
+    freeRun = GenericTarget::args.freeRun;
+    virtualTime = 0.0;
     StartWorkerThreads();
+    watchdog.Start(tasks);
+    statisticsUpdater.Start(tasks);
+    if(!freeRun){
+        loadShedding.Start(tasks);
+        sampleOffsetTuner.Start(tasks);
+    }
     StartMasterThread();
 }
 
 void BaseRateScheduler::Stop(void){
     StopMasterThread();
+    sampleOffsetTuner.Stop();
+    loadShedding.Stop();
+    statisticsUpdater.Stop();
+    watchdog.Stop();
     StopWorkerThreads();
 }
 
@@ -24,11 +38,16 @@ void BaseRateScheduler::MasterThread(void){
     uint64_t numCPUOverloads = 0;
     uint64_t numLostTicks = 0;
     uint64_t previousCPUOverloads = 0;
+    uint64_t tick = 0;
+    const uint64_t stopTick = (GenericTarget::args.stopTime < 0.0) ? std::numeric_limits<uint64_t>::max() : static_cast<uint64_t>(std::ceil(GenericTarget::args.stopTime / SimulinkInterface::baseSampleTime));
+    Trace::RegisterThread("base-rate scheduler");
+    tickSync.Reset();
 
     // Start the master clock
     GENERIC_TARGET_PRINT("Master thread started (baseSampleTime=%lf)\n", SimulinkInterface::baseSampleTime);
-    if(!masterClock.Start(SimulinkInterface::baseSampleTime)){
+    if(!masterClock.Start(SimulinkInterface::baseSampleTime, static_cast<periodic_timer_mode>(SimulinkInterface::timerMode), SimulinkInterface::timerSpinTime, static_cast<periodic_timer_alignment>(SimulinkInterface::timerAlignment), SimulinkInterface::timerPhaseOffset)){
         masterClock.Stop();
+        Trace::UnregisterThread();
         GenericTarget::ShouldTerminate();
         return;
     }
@@ -37,6 +56,7 @@ void BaseRateScheduler::MasterThread(void){
     while(!terminate){
         // Wait for a tick event from the master clock and break if clock was destroyed
         if(!masterClock.WaitForTick(firstTick)) break;
+        Trace::Event(trace_event::TIMER_WAKEUP, trace_phase::INSTANT, static_cast<uint32_t>(tick));
         firstTick = false;
         numCPUOverloads = masterClock.GetNumCPUOverloads();
         numLostTicks = masterClock.GetNumLostTicks();
@@ -51,54 +71,143 @@ void BaseRateScheduler::MasterThread(void){
             }
         }
 
-        // Check termination flag
+        // Check termination flag and stop time
         if(terminate){
             break;
         }
+        if((tick++) >= stopTick){
+            GENERIC_TARGET_PRINT("Stop time %lf has been reached\n", GenericTarget::args.stopTime);
+            GenericTarget::ShouldTerminate();
+            break;
+        }
 
-        // Signal periodic model tasks
-        for(auto&& task : tasks){
-            task->Notify();
+        // Signal periodic model tasks in rate-monotonic order (inline tasks are executed directly)
+        int64_t timeOfTickNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        for(auto&& task : executionOrder){
+            task->Notify(timeOfTickNs);
         }
+
+        // Send or receive sync beacons after all tasks have been notified
+        tickSync.Update(masterClock, tick - 1);
+
+        // Degrade or restore the rates of sheddable tasks
+        loadShedding.Update(numCPUOverloads);
+
+        // Apply automatically tuned sample offsets
+        sampleOffsetTuner.Update(tick - 1);
     }
 
     // Stop the master clock
     masterClock.Stop();
     GENERIC_TARGET_PRINT("Master thread has been stopped (%lu CPU overloads, %lu lost ticks)\n", numCPUOverloads, numLostTicks);
+    masterClock.GetWakeupLatencyHistogram().Print("Master thread wakeup latency");
+    if(static_cast<uint32_t>(periodic_timer_alignment::NONE) != SimulinkInterface::timerAlignment){
+        masterClock.GetPhaseErrorHistogram().Print("Master clock phase error");
+    }
+    if(static_cast<uint32_t>(tick_sync_mode::NONE) != SimulinkInterface::tickSyncMode){
+        TickSyncStatus status = tickSync.GetStatus();
+        GENERIC_TARGET_PRINT("Tick synchronization: %s, %lu beacons, phaseError=%.3lf us, periodAdjustment=%.3lf us\n", status.locked ? "locked" : "unlocked", status.numBeacons, 1e6 * status.phaseError, 1e6 * status.periodAdjustment);
+    }
+    Trace::UnregisterThread();
+}
+
+void BaseRateScheduler::FreeRunThread(void){
+    uint64_t tick = 0;
+    const uint64_t stopTick = (GenericTarget::args.stopTime < 0.0) ? std::numeric_limits<uint64_t>::max() : static_cast<uint64_t>(std::ceil(GenericTarget::args.stopTime / SimulinkInterface::baseSampleTime));
+    Trace::RegisterThread("base-rate scheduler");
+    GENERIC_TARGET_PRINT("Master thread started in free-run mode (baseSampleTime=%lf)\n", SimulinkInterface::baseSampleTime);
+    if(static_cast<uint32_t>(tick_sync_mode::NONE) != SimulinkInterface::tickSyncMode){
+        GENERIC_TARGET_PRINT_WARNING("Tick synchronization is not used in free-run mode!\n");
+    }
+    if(SimulinkInterface::loadShedding){
+        GENERIC_TARGET_PRINT_WARNING("Load shedding is not used in free-run mode!\n");
+    }
+    if(SimulinkInterface::autoSampleOffsets){
+        GENERIC_TARGET_PRINT_WARNING("Automatic sample offsets are not used in free-run mode!\n");
+    }
+    auto timeOfStart = std::chrono::steady_clock::now();
+
+    // The virtual master clock advances as soon as all due tasks of the current tick have finished
+    for(; !terminate; ++tick){
+        if(tick >= stopTick){
+            GENERIC_TARGET_PRINT("Stop time %lf has been reached\n", GenericTarget::args.stopTime);
+            GenericTarget::ShouldTerminate();
+            break;
+        }
+        virtualTime = double(tick) * SimulinkInterface::baseSampleTime;
+        int64_t timeOfTickNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        for(auto&& task : executionOrder){
+            task->Notify(timeOfTickNs);
+        }
+    }
+
+    // Print the speed-up with respect to realtime
+    double elapsedTime = 1e-9 * double(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - timeOfStart).count());
+    double modelTime = double(tick) * SimulinkInterface::baseSampleTime;
+    GENERIC_TARGET_PRINT("Master thread has been stopped (free-run: %lu ticks, model time %lf s in %lf s, %.1lfx realtime)\n", tick, modelTime, elapsedTime, (elapsedTime > 0.0) ? (modelTime / elapsedTime) : 0.0);
+    Trace::UnregisterThread();
 }
 
 void BaseRateScheduler::StartWorkerThreads(void){
+    // Either use the worker pool or one thread per task
+    workerPool.Start(freeRun ? 0 : SimulinkInterface::workerPoolSize);
+    WorkerPool* pool = workerPool.GetNumWorkers() ? &workerPool : nullptr;
     for(uint32_t id = 0; id < SIMULINK_INTERFACE_NUM_TIMINGS; id++){
-        tasks.push_back(new PeriodicTask(id));
-        tasks.back()->Start();
+        tasks.push_back(new PeriodicTask(id, pool));
+        tasks.back()->Start(freeRun);
     }
+
+    // Rate-monotonic order: fastest rate first, higher priority first for equal rates
+    executionOrder = tasks;
+    std::stable_sort(executionOrder.begin(), executionOrder.end(), [](const PeriodicTask* a, const PeriodicTask* b){
+        if(SimulinkInterface::sampleTicks[a->taskID] != SimulinkInterface::sampleTicks[b->taskID]){
+            return SimulinkInterface::sampleTicks[a->taskID] < SimulinkInterface::sampleTicks[b->taskID];
+        }
+        return SimulinkInterface::priorities[a->taskID] > SimulinkInterface::priorities[b->taskID];
+    });
 }
 
 void BaseRateScheduler::StopWorkerThreads(void){
+    // Workers must be stopped before tasks are deleted
+    workerPool.Stop();
     for(size_t n = 0; n < tasks.size(); n++){
         tasks[n]->Stop();
-        GENERIC_TARGET_PRINT("Task \"%s\" (priority=%d, samplerate=%lf) has been stopped: %lu task overloads\n", SimulinkInterface::taskNames[tasks[n]->taskID], SimulinkInterface::priorities[tasks[n]->taskID], SimulinkInterface::baseSampleTime*double(SimulinkInterface::sampleTicks[tasks[n]->taskID]), tasks[n]->GetNumTaskOverloads());
+        GENERIC_TARGET_PRINT("Task \"%s\" (priority=%d, samplerate=%lf) has been stopped: %lu task overloads, %lu lost activations%s\n", SimulinkInterface::taskNames[tasks[n]->taskID], SimulinkInterface::priorities[tasks[n]->taskID], SimulinkInterface::baseSampleTime*double(SimulinkInterface::sampleTicks[tasks[n]->taskID]), tasks[n]->GetNumTaskOverloads(), tasks[n]->GetNumLostActivations(), tasks[n]->IsInline() ? " (inline)" : "");
+        tasks[n]->GetStartLatencyHistogram().Print("  start latency");
+        tasks[n]->GetExecutionTimeHistogram().Print("  execution time");
+        tasks[n]->UpdateExecutionTimePercentiles();
+        TaskStatisticsSnapshot statistics = tasks[n]->GetExecutionTimeStatistics();
+        GENERIC_TARGET_PRINT("  execution time budget: %lu of %lu steps over budget (budget=%lf s, stddev=%.3lf us)\n", statistics.numOverBudget, statistics.count, SimulinkInterface::executionTimeBudgets[tasks[n]->taskID], 1e6 * std::sqrt(statistics.variance));
+        GENERIC_TARGET_PRINT("  preempted time: total=%.3lf us, max=%.3lf us\n", 1e6 * statistics.sumPreemptedTime, 1e6 * statistics.maxPreemptedTime);
+        if(SimulinkInterface::measureResourceUsage){
+            GENERIC_TARGET_PRINT("  resource usage: %lu voluntary context switches, %lu involuntary context switches, %lu minor faults, %lu major faults\n", statistics.usage.numVoluntaryContextSwitches, statistics.usage.numInvoluntaryContextSwitches, statistics.usage.numMinorFaults, statistics.usage.numMajorFaults);
+        }
         delete tasks[n];
     }
+    executionOrder.clear();
     tasks.clear();
     tasks.shrink_to_fit();
 }
 
 void BaseRateScheduler::StartMasterThread(void){
-    masterThread = std::thread(&BaseRateScheduler::MasterThread, this);
-    struct sched_param param;
-    param.sched_priority = GENERIC_TARGET_PRIORITY_BASE_RATE_SCHEDULER;
-    if(0 != pthread_setschedparam(masterThread.native_handle(), SCHED_FIFO, &param)){
-        GENERIC_TARGET_PRINT_WARNING("Could not set thread priority %d for base rate scheduler (sampletime=%lf)\n", GENERIC_TARGET_PRIORITY_BASE_RATE_SCHEDULER, SimulinkInterface::baseSampleTime);
+    // The free-running master thread never sleeps: keep the default priority, such that other threads (e.g. data recorders) are not starved
+    bool success;
+    if(freeRun){
+        success = masterThread.Start([this](){ FreeRunThread(); }, "gt-scheduler", 0, 0);
+    }
+    else{
+        success = masterThread.Start([this](){ MasterThread(); }, "gt-scheduler", GENERIC_TARGET_PRIORITY_BASE_RATE_SCHEDULER, SimulinkInterface::cpuAffinityBaseRateScheduler);
+    }
+    if(!success){
+        GENERIC_TARGET_PRINT_ERROR("Could not start the master thread (sampletime=%lf)\n", SimulinkInterface::baseSampleTime);
+        GenericTarget::ShouldTerminate();
     }
 }
 
 void BaseRateScheduler::StopMasterThread(void){
     terminate = true;
     masterClock.Stop();
-    if(masterThread.joinable()){
-        masterThread.join();
-    }
+    masterThread.Join();
     terminate = false;
 }
 
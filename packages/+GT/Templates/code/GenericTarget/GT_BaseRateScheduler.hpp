@@ -2,7 +2,14 @@
 
 
 #include <GenericTarget/GT_PeriodicTimer.hpp>
+#include <GenericTarget/GT_RealTimeThread.hpp>
+#include <GenericTarget/GT_TickSync.hpp>
+#include <GenericTarget/GT_Watchdog.hpp>
+#include <GenericTarget/GT_TaskStatisticsUpdater.hpp>
+#include <GenericTarget/GT_LoadShedding.hpp>
+#include <GenericTarget/GT_SampleOffsetTuner.hpp>
 #include <GenericTarget/GT_PeriodicTask.hpp>
+#include <GenericTarget/GT_WorkerPool.hpp>
 
 
 namespace gt {
@@ -30,9 +37,9 @@ class BaseRateScheduler {
 
         /**
          * @brief Get the model execution time (steady clock), that is, the elapsed time to the start of the master clock.
-         * @return Model execution time in seconds.
+         * @return Model execution time in seconds. In free-run mode, this is the virtual time of the current tick (number of ticks times the base sampletime).
          */
-        inline double GetModelExecutionTime(void){ return masterClock.GetTimeToStart(); }
+        inline double GetModelExecutionTime(void){ return freeRun ? virtualTime.load() : masterClock.GetTimeToStart(); }
 
         /**
          * @brief Get the number of CPU overloads that have been occurred since the start of the base-rate scheduler.
@@ -46,6 +53,36 @@ class BaseRateScheduler {
          */
         inline uint64_t GetNumLostTicks(void){ return masterClock.GetNumLostTicks(); }
 
+        /**
+         * @brief Get the histogram of wakeup latencies of the master thread since the start of the base-rate scheduler.
+         * @return Histogram of wakeup latencies (actual wakeup vs. ideal expiry of the master clock).
+         */
+        inline const LatencyHistogram& GetWakeupLatencyHistogram(void){ return masterClock.GetWakeupLatencyHistogram(); }
+
+        /**
+         * @brief Get the phase error of the latest tick of the master clock with respect to the aligned reference clock.
+         * @return Phase error in seconds (positive if the tick is late) or zero if the master clock is not aligned.
+         */
+        inline double GetPhaseError(void){ return masterClock.GetPhaseError(); }
+
+        /**
+         * @brief Get the histogram of absolute phase errors of the master clock since the start of the base-rate scheduler.
+         * @return Histogram of absolute phase errors (only recorded if the master clock is aligned).
+         */
+        inline const LatencyHistogram& GetPhaseErrorHistogram(void){ return masterClock.GetPhaseErrorHistogram(); }
+
+        /**
+         * @brief Register the multicast socket of the tick synchronization.
+         * @details This function must be called before the UDP multicast manager creates all sockets.
+         */
+        inline void RegisterTickSync(void){ tickSync.Register(); }
+
+        /**
+         * @brief Get a consistent snapshot of the tick synchronization status.
+         * @return The tick synchronization status (phase error, lock status, period adjustment, number of beacons).
+         */
+        inline TickSyncStatus GetTickSyncStatus(void){ return tickSync.GetStatus(); }
+
         /**
          * @brief Get the latest task execution time for a task.
          * @param [in] taskID The ID of the task from which to obtain the latest task execution time.
@@ -58,6 +95,30 @@ class BaseRateScheduler {
             return tasks[taskID]->GetTaskExecutionTime();
         }
 
+        /**
+         * @brief Get the latest CPU time for a task.
+         * @param [in] taskID The ID of the task from which to obtain the latest CPU time.
+         * @return The CPU time of the thread during the latest step in seconds or a negative value if the taskID is invalid.
+         */
+        inline double GetTaskCPUTime(const uint32_t taskID){
+            if(taskID >= (uint32_t)tasks.size())
+                return -1.0;
+            return tasks[taskID]->GetTaskCPUTime();
+        }
+
+        /**
+         * @brief Get a consistent snapshot of the execution time statistics for a task.
+         * @param [in] taskID The ID of the task from which to obtain the statistics.
+         * @param [out] statistics The snapshot of the execution time statistics, including CPU time, preempted time and resource usage counters.
+         * @return True if success, false if the taskID is invalid.
+         */
+        inline bool GetTaskExecutionTimeStatistics(const uint32_t taskID, TaskStatisticsSnapshot& statistics){
+            if(taskID >= (uint32_t)tasks.size())
+                return false;
+            statistics = tasks[taskID]->GetExecutionTimeStatistics();
+            return true;
+        }
+
         /**
          * @brief Get the number of task overloads for a task.
          * @param [in] taskID The ID of the task from which to obtain the latest number of task overloads.
@@ -69,17 +130,97 @@ class BaseRateScheduler {
             return tasks[taskID]->GetNumTaskOverloads();
         }
 
+        /**
+         * @brief Get the number of lost activations for a task.
+         * @param [in] taskID The ID of the task from which to obtain the number of lost activations.
+         * @return The number of activations that have been dropped according to the overrun policy of the task or zero if the taskID is invalid.
+         */
+        inline uint64_t GetNumLostActivations(const uint32_t taskID){
+            if(taskID >= (uint32_t)tasks.size())
+                return 0;
+            return tasks[taskID]->GetNumLostActivations();
+        }
+
+        /**
+         * @brief Get the histogram of start latencies for a task.
+         * @param [in] taskID The ID of the task from which to obtain the histogram.
+         * @return Pointer to the histogram of start latencies (notification to start of step function) or nullptr if the taskID is invalid.
+         */
+        inline const LatencyHistogram* GetTaskStartLatencyHistogram(const uint32_t taskID){
+            if(taskID >= (uint32_t)tasks.size())
+                return nullptr;
+            return &tasks[taskID]->GetStartLatencyHistogram();
+        }
+
+        /**
+         * @brief Get the histogram of task execution times for a task.
+         * @param [in] taskID The ID of the task from which to obtain the histogram.
+         * @return Pointer to the histogram of task execution times or nullptr if the taskID is invalid.
+         */
+        inline const LatencyHistogram* GetTaskExecutionTimeHistogram(const uint32_t taskID){
+            if(taskID >= (uint32_t)tasks.size())
+                return nullptr;
+            return &tasks[taskID]->GetExecutionTimeHistogram();
+        }
+
+        /**
+         * @brief Get the number of workers of the worker pool.
+         * @return Number of workers or zero if the worker pool is not used.
+         */
+        inline uint32_t GetNumWorkers(void){ return workerPool.GetNumWorkers(); }
+
+        /**
+         * @brief Get the number of hung steps that have been detected by the watchdog.
+         * @return Number of steps that took longer than the watchdog timeout.
+         */
+        inline uint64_t GetNumHungSteps(void){ return watchdog.GetNumHungSteps(); }
+
+        /**
+         * @brief Get the current mode of the load shedding.
+         * @return The current mode (degraded if sheddable tasks are slowed down and the data recorders are throttled).
+         */
+        inline load_shedding_mode GetLoadSheddingMode(void){ return loadShedding.GetMode(); }
+
+        /**
+         * @brief Get the number of transitions to the degraded mode of the load shedding.
+         * @return Number of degradations since the start of the base-rate scheduler.
+         */
+        inline uint64_t GetNumDegradations(void){ return loadShedding.GetNumDegradations(); }
+
+        /**
+         * @brief Get the utilization of a worker of the worker pool.
+         * @param [in] workerID The ID of the worker.
+         * @return Ratio of the time the worker executed steps to the elapsed time since the start or a negative value if the workerID is invalid.
+         */
+        inline double GetWorkerUtilization(const uint32_t workerID){ return workerPool.GetUtilization(workerID); }
+
     private:
-        std::thread masterThread;           ///< Thread object for the master thread.
-        std::atomic<bool> terminate;        ///< Termination flag: true if master thread is to be terminated, false otherwise.
-        std::vector<PeriodicTask*> tasks;   ///< A list of periodic worker tasks.
-        PeriodicTimer masterClock;          ///< A periodic timer that represents the master clock.
+        RealTimeThread masterThread;                 ///< Thread object for the master thread.
+        std::atomic<bool> terminate;                 ///< Termination flag: true if master thread is to be terminated, false otherwise.
+        std::atomic<bool> freeRun;                   ///< True if the master clock is virtual and advances as soon as all due tasks have finished (free-run mode).
+        std::atomic<double> virtualTime;             ///< Virtual time of the current tick in seconds (only used in free-run mode).
+        std::vector<PeriodicTask*> tasks;            ///< A list of periodic worker tasks.
+        std::vector<PeriodicTask*> executionOrder;   ///< All periodic worker tasks in rate-monotonic order (fastest rate first).
+        PeriodicTimer masterClock;                   ///< A periodic timer that represents the master clock.
+        TickSync tickSync;                           ///< Keeps the ticks of the master clock phase-locked to the ticks of other targets.
+        Watchdog watchdog;                           ///< Detects hung steps and prints the backtrace of the stuck thread.
+        TaskStatisticsUpdater statisticsUpdater;     ///< Refreshes the execution time percentiles of all tasks off the realtime threads.
+        LoadShedding loadShedding;                   ///< Slows down sheddable tasks and throttles the data recorders under sustained overload.
+        SampleOffsetTuner sampleOffsetTuner;         ///< Spreads the activations of slower tasks over the ticks of the master clock based on measured execution times.
+        WorkerPool workerPool;                       ///< Optional worker pool that executes the steps of all tasks.
 
         /**
          * @brief Internal master thread function.
          */
         void MasterThread(void);
 
+        /**
+         * @brief Internal master thread function for the free-run mode.
+         * @details The master clock is virtual. For each tick, all due tasks are executed one after the other in rate-monotonic order by this thread,
+         * then the virtual time advances by one base sampletime. The model runs as fast as possible and the order of all steps is deterministic.
+         */
+        void FreeRunThread(void);
+
         /**
          * @brief Start all worker threads.
          */
@@ -16,6 +16,7 @@
 #include <array>
 #include <string>
 #include <cstring>
+#include <cstdlib>
 #include <algorithm>
 #include <thread>
 #include <mutex>
@@ -30,6 +31,10 @@
 #include <filesystem>
 #include <csignal>
 #include <tuple>
+#include <limits>
+#include <bit>
+#include <numeric>
+#include <functional>
 
 
 /* OS depending */
@@ -39,6 +44,8 @@
 #include <Ws2tcpip.h>
 #include <windows.h>
 #include <Iphlpapi.h>
+#include <io.h>
+#include <fcntl.h>
 // Unix System
 #elif __linux__
 #include <execinfo.h>
@@ -50,10 +57,22 @@
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/timerfd.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <malloc.h>
+#include <alloca.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <linux/io_uring.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <netdb.h>
 #include <sys/utsname.h>
+#include <pthread.h>
+#include <sched.h>
 #include <net/if.h>
 #else
 // Other
@@ -126,8 +145,131 @@ inline std::string ToPrintableString(std::string s){
 #define GENERIC_TARGET_PRIORITY_BASE_RATE_SCHEDULER      (99)
 #define GENERIC_TARGET_DIRECTORY_PROTOCOL                "protocol"
 #define GENERIC_TARGET_DIRECTORY_DATA_RECORD             "data"
+#define GENERIC_TARGET_DIRECTORY_TRACE                   "trace"
 #define GENERIC_TARGET_FILE_NAME_DATA_RECORD_INDEX       "index"
 #define GENERIC_TARGET_UDP_RETRY_TIME_MS                 (1000)
+#define GENERIC_TARGET_DEADLINE_CALIBRATION_STEPS        (100)
+#define GENERIC_TARGET_TIMER_PHASE_DEADBAND_NS           (1000)
+#define GENERIC_TARGET_TIMER_PHASE_MAX_CORRECTION        (0.01)
+#define GENERIC_TARGET_TIMER_REARM_THRESHOLD_NS          (5000)
+#define GENERIC_TARGET_TIMER_REARM_INTERVAL_TICKS        (100)
+#define GENERIC_TARGET_PRIORITY_TICK_SYNC                (98)
+#define GENERIC_TARGET_TICK_SYNC_GAIN_P                  (0.5)
+#define GENERIC_TARGET_TICK_SYNC_GAIN_I                  (0.05)
+#define GENERIC_TARGET_TICK_SYNC_LOCK_THRESHOLD          (0.02)
+#define GENERIC_TARGET_TICK_SYNC_LOCK_COUNT              (10)
+#define GENERIC_TARGET_TICK_SYNC_TIMEOUT                 (10)
+#define GENERIC_TARGET_WATCHDOG_INTERVAL_MS              (10)
+#define GENERIC_TARGET_WATCHDOG_BACKTRACE_SIZE           (64)
+#define GENERIC_TARGET_WATCHDOG_BACKTRACE_TIMEOUT_MS     (100)
+#define GENERIC_TARGET_SIGNAL_WATCHDOG                   (SIGRTMIN + 1)
+#define GENERIC_TARGET_LOAD_SHEDDING_WINDOW              (0.1)
+#define GENERIC_TARGET_LOAD_SHEDDING_ENTER_WINDOWS       (3)
+#define GENERIC_TARGET_LOAD_SHEDDING_EXIT_WINDOWS        (50)
+#define GENERIC_TARGET_SAMPLE_OFFSET_INTERVAL_MS         (100)
+#define GENERIC_TARGET_SAMPLE_OFFSET_NUM_STEPS           (20)
+#define GENERIC_TARGET_SAMPLE_OFFSET_MAX_TICKS           (65536)
+#define GENERIC_TARGET_CACHE_LINE_SIZE                   (64)
+#define GENERIC_TARGET_DATA_RECORDER_FLUSH_INTERVAL_MS   (100)
+#define GENERIC_TARGET_TASK_STATISTICS_INTERVAL_MS       (100)
+#define GENERIC_TARGET_DATA_RECORDER_ALIGNMENT           (4096)
+
+
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Thread Settings
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+namespace gt {
+
+
+/**
+ * @brief Set the scheduling policy of the calling thread to SCHED_DEADLINE.
+ * @param [in] runtimeNs Runtime budget in nanoseconds per period.
+ * @param [in] deadlineNs Relative deadline in nanoseconds.
+ * @param [in] periodNs Period in nanoseconds.
+ * @return True if success, false otherwise, e.g. if the kernel refuses the parameters (admission control) or does not support SCHED_DEADLINE.
+ * @details If false is returned, the scheduling policy of the calling thread is not changed and errno indicates the reason.
+ * On windows, SCHED_DEADLINE is not supported and false is returned.
+ */
+inline bool SetThreadDeadlineScheduling(uint64_t runtimeNs, uint64_t deadlineNs, uint64_t periodNs){
+    #if defined(_WIN32) || !defined(SYS_sched_setattr)
+    (void) runtimeNs;
+    (void) deadlineNs;
+    (void) periodNs;
+    return false;
+    #else
+    // Layout of struct sched_attr (SCHED_ATTR_SIZE_VER0), which is not provided by all C libraries
+    struct {
+        uint32_t size;
+        uint32_t sched_policy;
+        uint64_t sched_flags;
+        int32_t sched_nice;
+        uint32_t sched_priority;
+        uint64_t sched_runtime;
+        uint64_t sched_deadline;
+        uint64_t sched_period;
+    } attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.sched_policy = 6; // SCHED_DEADLINE
+    attr.sched_runtime = runtimeNs;
+    attr.sched_deadline = deadlineNs;
+    attr.sched_period = periodNs;
+    return (0 == syscall(SYS_sched_setattr, 0, &attr, 0));
+    #endif
+}
+
+/**
+ * @brief Resource usage counters of a thread.
+ */
+struct ResourceUsage {
+    uint64_t numVoluntaryContextSwitches;     ///< Number of voluntary context switches, e.g. the thread blocked while waiting for a resource.
+    uint64_t numInvoluntaryContextSwitches;   ///< Number of involuntary context switches, e.g. the thread was preempted by a thread with higher priority or an IRQ thread.
+    uint64_t numMinorFaults;                  ///< Number of page faults that have been serviced without any I/O activity.
+    uint64_t numMajorFaults;                  ///< Number of page faults that required I/O activity.
+};
+
+/**
+ * @brief Get the CPU time consumed by the calling thread.
+ * @return CPU time of the calling thread in nanoseconds.
+ * @details On windows, the thread CPU time is not supported and zero is returned.
+ */
+inline int64_t GetThreadCPUTime(void){
+    #ifdef _WIN32
+    return 0;
+    #else
+    struct timespec ts;
+    if(0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts)){
+        return 0;
+    }
+    return int64_t(ts.tv_sec) * int64_t(1000000000) + int64_t(ts.tv_nsec);
+    #endif
+}
+
+/**
+ * @brief Get the resource usage counters of the calling thread.
+ * @param [out] usage The resource usage counters of the calling thread.
+ * @return True if success, false otherwise. In this case all counters are set to zero.
+ * @details On windows, the resource usage of a thread is not supported and false is returned.
+ */
+inline bool GetThreadResourceUsage(ResourceUsage& usage){
+    usage = ResourceUsage();
+    #if defined(_WIN32) || !defined(RUSAGE_THREAD)
+    return false;
+    #else
+    struct rusage ru;
+    if(0 != getrusage(RUSAGE_THREAD, &ru)){
+        return false;
+    }
+    usage.numVoluntaryContextSwitches = static_cast<uint64_t>(ru.ru_nvcsw);
+    usage.numInvoluntaryContextSwitches = static_cast<uint64_t>(ru.ru_nivcsw);
+    usage.numMinorFaults = static_cast<uint64_t>(ru.ru_minflt);
+    usage.numMajorFaults = static_cast<uint64_t>(ru.ru_majflt);
+    return true;
+    #endif
+}
+
+
+} /* namespace: gt */
 
 
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -1,7 +1,7 @@
 #pragma once
 
 
-#include <GenericTarget/GT_Common.hpp>
+#include <GenericTarget/GT_WakeupSignal.hpp>
 
 
 namespace gt {
@@ -9,6 +9,7 @@ namespace gt {
 
 /**
  * @brief The event class can be used to wait within a thread for an event that is notified by another thread.
+ * @details The event is based on a lock-free @ref WakeupSignal, only one thread is allowed to wait for an event.
  */
 class Event {
     public:
@@ -22,11 +23,8 @@ class Event {
          * @param [in] flag User-specific value that should be forwarded to the waiting thread. Note that -1 is used as default value and therefore to indicate timeout when calling @ref WaitFor.
          */
         inline void NotifyOne(int flag){
-            std::unique_lock<std::mutex> lock(mtx);
-            notified = true;
-            _flag = flag;
-            cv.notify_one();
-            std::this_thread::yield();
+            _flag.store(flag, std::memory_order_relaxed);
+            signal.Notify();
         }
 
         /**
@@ -34,12 +32,8 @@ class Event {
          * @return The user-specific value that has been set during the @ref NotifyOne call.
          */
         inline int Wait(void){
-            std::unique_lock<std::mutex> lock(mtx);
-            cv.wait(lock, [this](){ return this->notified; });
-            notified = false;
-            int ret = _flag;
-            _flag = -1;
-            return ret;
+            signal.Wait();
+            return _flag.exchange(-1, std::memory_order_relaxed);
         }
 
         /**
@@ -48,28 +42,23 @@ class Event {
          * @return The user-specific value that has been set during the @ref NotifyOne call or -1 in case of timeout.
          */
         inline int WaitFor(uint32_t timeoutMs){
-            std::unique_lock<std::mutex> lock(mtx);
-            cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this](){ return this->notified; });
-            notified = false;
-            int ret = _flag;
-            _flag = -1;
-            return ret;
+            if(!signal.WaitFor(timeoutMs)){
+                return -1;
+            }
+            return _flag.exchange(-1, std::memory_order_relaxed);
         }
 
         /**
          * @brief Clear a notified event.
          */
         inline void Clear(void){
-            std::unique_lock<std::mutex> lock(mtx);
-            notified = false;
+            signal.Clear();
             _flag = -1;
         }
 
     private:
-        int _flag;                    ///< User-specific value set during notification. The default value is -1.
-        std::mutex mtx;               ///< The mutex used for event notification.
-        std::condition_variable cv;   ///< The condition variable used for event notification.
-        bool notified;                ///< A boolean flag to prevent spurious wakeups.
+        std::atomic<int> _flag;   ///< User-specific value set during notification. The default value is -1.
+        WakeupSignal signal;      ///< The lock-free wakeup signal used for event notification.
 };
 
 
@@ -4,6 +4,9 @@ using namespace gt;
 
 
 FileSystem::FileSystem(){
+    numTraceFiles = 0;
+    numRotations = 0;
+
     // Get the absolute path to the application
     #ifdef _WIN32
     char* buffer = new char[65536];
@@ -44,13 +47,30 @@ bool FileSystem::MakeDataRecordDirectory(void){
     return true;
 }
 
+bool FileSystem::MakeTraceDirectory(void){
+    std::filesystem::path directory = pathToApplication / GENERIC_TARGET_DIRECTORY_TRACE;
+    try{
+        std::filesystem::create_directory(directory);
+    }
+    catch(...){
+        GENERIC_TARGET_PRINT_ERROR("Could not create trace directory \"%s\"!\n", directory.string().c_str());
+        return false;
+    }
+    return true;
+}
+
 std::string FileSystem::GetProtocolFilename(void){
     std::filesystem::path p = pathToApplication / GENERIC_TARGET_DIRECTORY_PROTOCOL / (GenericTarget::targetTime.GetUpTimeUTCString() + ".txt");
     return p.string();
 }
 
 std::filesystem::path FileSystem::GetDataRecordDirectory(void){
-    return pathToApplication / GENERIC_TARGET_DIRECTORY_DATA_RECORD / GenericTarget::targetTime.GetUpTimeUTCString();
+    uint32_t n = numRotations;
+    return pathToApplication / GENERIC_TARGET_DIRECTORY_DATA_RECORD / (n ? (GenericTarget::targetTime.GetUpTimeUTCString() + "_" + std::to_string(n)) : GenericTarget::targetTime.GetUpTimeUTCString());
+}
+
+void FileSystem::RotateDataRecordDirectory(void){
+    numRotations++;
 }
 
 std::string FileSystem::GetDataRecordIndexFilename(void){
@@ -58,6 +78,11 @@ std::string FileSystem::GetDataRecordIndexFilename(void){
     return p.string();
 }
 
+std::string FileSystem::GetTraceFilename(void){
+    std::filesystem::path p = pathToApplication / GENERIC_TARGET_DIRECTORY_TRACE / (GenericTarget::targetTime.GetUpTimeUTCString() + "_" + std::to_string(numTraceFiles++) + ".json");
+    return p.string();
+}
+
 void FileSystem::KeepNLatestProtocolFiles(uint32_t N){
     std::filesystem::path directory = pathToApplication / GENERIC_TARGET_DIRECTORY_PROTOCOL;
     std::vector<std::filesystem::path> files;
@@ -26,12 +26,30 @@ class FileSystem {
          */
         bool MakeDataRecordDirectory(void);
 
+        /**
+         * @brief Make the trace directory if it does not exist.
+         * @return True if success, false otherwise.
+         */
+        bool MakeTraceDirectory(void);
+
         /**
          * @brief Get the absolute path to the data record directory.
-         * @return Absolute path to the data record directory.
+         * @return Absolute path to the data record directory, format: YYYYMMDD_hhmmssmmm or YYYYMMDD_hhmmssmmm_N after N calls to @ref RotateDataRecordDirectory.
          */
         std::filesystem::path GetDataRecordDirectory(void);
 
+        /**
+         * @brief Start a new data record directory. Subsequent calls to @ref GetDataRecordDirectory return a new directory.
+         * @details The directory is not created by this function, call @ref MakeDataRecordDirectory to create it.
+         */
+        void RotateDataRecordDirectory(void);
+
+        /**
+         * @brief Get the number of calls to @ref RotateDataRecordDirectory.
+         * @return Number of data record directories that have been started in addition to the initial one.
+         */
+        inline uint32_t GetNumDataRecordRotations(void){ return numRotations; }
+
         /**
          * @brief Get the absolute filename to the protocol file.
          * @return Absolute filename to the protocol file.
@@ -44,6 +62,12 @@ class FileSystem {
          */
         std::string GetDataRecordIndexFilename(void);
 
+        /**
+         * @brief Get a new absolute filename for a trace file. Each call returns a new filename.
+         * @return Absolute filename for a trace file, format: YYYYMMDD_hhmmssmmm_N.json.
+         */
+        std::string GetTraceFilename(void);
+
         /**
          * @brief Keep the N latest protocol files by removing older ones.
          * @param [in] N The number of the latest protocol files to keep.
@@ -52,6 +76,8 @@ class FileSystem {
 
     private:
         std::filesystem::path pathToApplication; ///< Absolute path to the application (generated during construction).
+        std::atomic<uint32_t> numTraceFiles;     ///< Number of trace filenames that have been generated.
+        std::atomic<uint32_t> numRotations;      ///< Number of data record directories that have been started in addition to the initial one.
 };
 
 
@@ -41,6 +41,20 @@ bool GenericTarget::Initialize(int argc, char**argv){
     PrintInfo(argc, argv);
     GENERIC_TARGET_PRINT("Initializing application ...\n");
 
+    // Check for the "--dump-trace" argument
+    if(args.dumpTrace){
+        GENERIC_TARGET_PRINT("Requesting a trace dump from another possibly ongoing target application (port=%u)\n", SimulinkInterface::portAppSocket);
+        DumpTraceOfOtherTargetApplication();
+        return false;
+    }
+
+    // Check for the "--restart" and "--restart-rotate" arguments
+    if(args.restart || args.rotate){
+        GENERIC_TARGET_PRINT("Restarting the model of another possibly ongoing target application (port=%u)\n", SimulinkInterface::portAppSocket);
+        RestartOtherTargetApplication(args.rotate);
+        return false;
+    }
+
     // Check for the "--stop" argument
     if(args.stop){
         GENERIC_TARGET_PRINT("Stopping another possibly ongoing target application (port=%u)\n", SimulinkInterface::portAppSocket);
@@ -48,6 +62,11 @@ bool GenericTarget::Initialize(int argc, char**argv){
         return false;
     }
 
+    // Lock memory for realtime operation, failures are not fatal
+    if(SimulinkInterface::lockMemory){
+        (void) RealTimeMemory::Lock(SimulinkInterface::heapReserveSize);
+    }
+
     // Initialize
     if(!InitializeAppSocket()){
         goto init_fail;
@@ -76,7 +95,11 @@ void GenericTarget::Terminate(void){
     udpUnicastManager.Destroy();
     GENERIC_TARGET_PRINT("Destroying data recorders\n");
     dataRecorderManager.DestroyAllDataRecorders();
+    if(SimulinkInterface::traceBufferSize){
+        (void) Trace::Dump();
+    }
     appSocket.Close();
+    GENERIC_TARGET_PRINT("Resident set size: %.3lf MiB\n", double(RealTimeMemory::GetResidentSetSize()) / 1048576.0);
 }
 
 void GenericTarget::MainLoop(void){
@@ -86,6 +109,7 @@ void GenericTarget::MainLoop(void){
     // Wait until application socket is closed or a termination message is received
     Address source;
     uint8_t u[4];
+    uint32_t numRestarts = 0;
     while(!shouldTerminate && appSocket.IsOpen()){
         int32_t rx = appSocket.ReceiveFrom(source, &u[0], 4);
         if((rx < 0) || source.IsZero()){
@@ -94,15 +118,53 @@ void GenericTarget::MainLoop(void){
         if((source.ip == std::array<uint8_t,4>({127,0,0,1})) && (4 == rx) && (0x47 == u[0]) && (0x54 == u[1]) && (0xDE == u[2]) && (0xAD == u[3])){
             break;
         }
+        if((source.ip == std::array<uint8_t,4>({127,0,0,1})) && (4 == rx) && (0x47 == u[0]) && (0x54 == u[1]) && (0x7A == u[2]) && (0xCE == u[3])){
+            GENERIC_TARGET_PRINT("Received trace message, dumping the trace\n");
+            (void) Trace::Dump();
+        }
+        if((source.ip == std::array<uint8_t,4>({127,0,0,1})) && (4 == rx) && (0x47 == u[0]) && (0x54 == u[1]) && (0xB0 == u[2]) && ((0x07 == u[3]) || (0x7D == u[3]))){
+            GENERIC_TARGET_PRINT("Received restart message (restart %u)\n", ++numRestarts);
+            if(!RestartModel(0x7D == u[3])){
+                break;
+            }
+        }
     }
     GENERIC_TARGET_PRINT("Received termination flag, application will be closed\n");
 }
 
+bool GenericTarget::RestartModel(bool rotate){
+    // UDP sockets, the application socket and locked memory are kept, only the scheduler and the model state are restarted
+    GENERIC_TARGET_PRINT("Restarting simulink model ...\n");
+    scheduler.Stop();
+    GENERIC_TARGET_PRINT("Terminating the simulink model\n");
+    SimulinkInterface::Terminate();
+    if(rotate){
+        GENERIC_TARGET_PRINT("Destroying data recorders\n");
+        dataRecorderManager.DestroyAllDataRecorders();
+        fileSystem.RotateDataRecordDirectory();
+    }
+    GENERIC_TARGET_PRINT("Initializing simulink model\n");
+    SimulinkInterface::Initialize();
+    if(rotate){
+        GENERIC_TARGET_PRINT("Creating data recorders\n");
+        if(!dataRecorderManager.CreateAllDataRecorders()){
+            GENERIC_TARGET_PRINT_ERROR("Restart failed\n");
+            return false;
+        }
+    }
+    GENERIC_TARGET_PRINT("Starting simulink model\n");
+    scheduler.Start();
+    return true;
+}
+
 void GenericTarget::SetSignalHandlers(void){
     std::set_terminate(GenericTarget::TerminateHandler);
     std::signal(SIGINT, &GenericTarget::SignalHandler);
     std::signal(SIGTERM, &GenericTarget::SignalHandler);
     std::signal(SIGSEGV, &GenericTarget::SignalHandler);
+    #ifndef _WIN32
+    std::signal(SIGUSR1, &GenericTarget::SignalHandler);
+    #endif
 }
 
 void GenericTarget::SignalHandler(int signum){
@@ -115,6 +177,11 @@ void GenericTarget::SignalHandler(int signum){
         case SIGTERM:
             GenericTarget::ShouldTerminate();
             break;
+        #ifndef _WIN32
+        case SIGUSR1:
+            GenericTarget::RequestTraceDump();
+            break;
+        #endif
     }
 }
 
@@ -173,12 +240,29 @@ void GenericTarget::PrintInfo(int argc, char**argv){
     GENERIC_TARGET_PRINT_RAW("portAppSocket:            %u\n", SimulinkInterface::portAppSocket);
     GENERIC_TARGET_PRINT_RAW("terminateAtTaskOverload:  %s\n", SimulinkInterface::terminateAtTaskOverload ? "true" : "false");
     GENERIC_TARGET_PRINT_RAW("terminateAtCPUOverload:   %s\n", SimulinkInterface::terminateAtCPUOverload ? "true" : "false");
+    GENERIC_TARGET_PRINT_RAW("watchdog:                 timeoutFactor=%lf, terminate=%s\n", SimulinkInterface::watchdogTimeoutFactor, SimulinkInterface::watchdogTerminate ? "true" : "false");
+    GENERIC_TARGET_PRINT_RAW("loadShedding:             %s (factor=%u)\n", SimulinkInterface::loadShedding ? "true" : "false", SimulinkInterface::loadSheddingFactor);
     GENERIC_TARGET_PRINT_RAW("priorityDataRecorder:     %d\n", SimulinkInterface::priorityDataRecorder);
+    GENERIC_TARGET_PRINT_RAW("dataRecorderBufferTime:   %lf s\n", SimulinkInterface::dataRecorderBufferTime);
+    GENERIC_TARGET_PRINT_RAW("numDataRecorderThreads:   %u\n", SimulinkInterface::numDataRecorderThreads);
+    GENERIC_TARGET_PRINT_RAW("dataRecorderBlockSize:    %u bytes\n", SimulinkInterface::dataRecorderBlockSize);
+    GENERIC_TARGET_PRINT_RAW("dataRecorderDirectIO:     %s\n", SimulinkInterface::dataRecorderDirectIO ? "true" : "false");
+    GENERIC_TARGET_PRINT_RAW("cpuAffinity:              baseRateScheduler=0x%llX, dataRecorder=0x%llX, network=0x%llX\n", (unsigned long long)SimulinkInterface::cpuAffinityBaseRateScheduler, (unsigned long long)SimulinkInterface::cpuAffinityDataRecorder, (unsigned long long)SimulinkInterface::cpuAffinityNetwork);
     GENERIC_TARGET_PRINT_RAW("baseSampleTime:           %lf s\n", SimulinkInterface::baseSampleTime);
+    GENERIC_TARGET_PRINT_RAW("autoSampleOffsets:        %s\n", SimulinkInterface::autoSampleOffsets ? "true" : "false");
+    GENERIC_TARGET_PRINT_RAW("inlineExecution:          %s (threshold=%lf s)\n", SimulinkInterface::inlineExecution ? "true" : "false", SimulinkInterface::inlineExecutionTimeThreshold);
+    GENERIC_TARGET_PRINT_RAW("workerPool:               size=%u, cpuAffinity=0x%llX\n", SimulinkInterface::workerPoolSize, (unsigned long long)SimulinkInterface::cpuAffinityWorkerPool);
+    GENERIC_TARGET_PRINT_RAW("schedulingPolicy:         %s (deadlineRuntimeMargin=%lf)\n", (SimulinkInterface::schedulingPolicy == static_cast<uint32_t>(task_scheduling_policy::DEADLINE)) ? "deadline" : "fifo", SimulinkInterface::deadlineRuntimeMargin);
+    GENERIC_TARGET_PRINT_RAW("measureResourceUsage:     %s\n", SimulinkInterface::measureResourceUsage ? "true" : "false");
+    GENERIC_TARGET_PRINT_RAW("traceBufferSize:          %u\n", SimulinkInterface::traceBufferSize);
+    GENERIC_TARGET_PRINT_RAW("lockMemory:               %s (heapReserveSize=%u, stackPrefaultSize=%u)\n", SimulinkInterface::lockMemory ? "true" : "false", SimulinkInterface::heapReserveSize, SimulinkInterface::stackPrefaultSize);
+    GENERIC_TARGET_PRINT_RAW("timerMode:                %s (spinTime=%lf s)\n", (SimulinkInterface::timerMode == static_cast<uint32_t>(periodic_timer_mode::ABSOLUTE_DEADLINE)) ? "clock_nanosleep" : "timerfd", SimulinkInterface::timerSpinTime);
+    GENERIC_TARGET_PRINT_RAW("timerAlignment:           %s (phaseOffset=%lf s)\n", (SimulinkInterface::timerAlignment == static_cast<uint32_t>(periodic_timer_alignment::TAI)) ? "tai" : ((SimulinkInterface::timerAlignment == static_cast<uint32_t>(periodic_timer_alignment::REALTIME)) ? "utc" : "none"), SimulinkInterface::timerPhaseOffset);
+    GENERIC_TARGET_PRINT_RAW("tickSync:                 %s (group=%u.%u.%u.%u, port=%u, interface=%u.%u.%u.%u, interval=%u, latency=%lf s)\n", (SimulinkInterface::tickSyncMode == static_cast<uint32_t>(tick_sync_mode::MASTER)) ? "master" : ((SimulinkInterface::tickSyncMode == static_cast<uint32_t>(tick_sync_mode::SLAVE)) ? "slave" : "none"), SimulinkInterface::tickSyncGroup[0], SimulinkInterface::tickSyncGroup[1], SimulinkInterface::tickSyncGroup[2], SimulinkInterface::tickSyncGroup[3], SimulinkInterface::tickSyncPort, SimulinkInterface::tickSyncInterface[0], SimulinkInterface::tickSyncInterface[1], SimulinkInterface::tickSyncInterface[2], SimulinkInterface::tickSyncInterface[3], SimulinkInterface::tickSyncInterval, SimulinkInterface::tickSyncLatency);
     GENERIC_TARGET_PRINT_RAW("tasks:                    ");
     for(int i = 0; i < SIMULINK_INTERFACE_NUM_TIMINGS; ++i){
         if(i) GENERIC_TARGET_PRINT_RAW("                          ");
-        GENERIC_TARGET_PRINT_RAW("[%d]: name=\"%s\", sampleTicks=%d, priority=%d\n", i, SimulinkInterface::taskNames[i], SimulinkInterface::sampleTicks[i], SimulinkInterface::priorities[i]);
+        GENERIC_TARGET_PRINT_RAW("[%d]: name=\"%s\", sampleTicks=%d, sampleOffsetTicks=%u, priority=%d, cpuAffinity=0x%llX, overrunPolicy=%u, activationQueueSize=%u, executionTimeBudget=%lf, sheddable=%s\n", i, SimulinkInterface::taskNames[i], SimulinkInterface::sampleTicks[i], SimulinkInterface::sampleOffsetTicks[i], SimulinkInterface::priorities[i], (unsigned long long)SimulinkInterface::cpuAffinity[i], SimulinkInterface::overrunPolicies[i], SimulinkInterface::activationQueueSizes[i], SimulinkInterface::executionTimeBudgets[i], SimulinkInterface::sheddable[i] ? "true" : "false");
     }
     GENERIC_TARGET_PRINT_RAW("\n");
     GENERIC_TARGET_PRINT_RAW("\n");
@@ -225,6 +309,18 @@ void GenericTarget::PrintNetworkInfo(void){
 }
 
 void GenericTarget::StopOtherTargetApplication(void){
+    SendToOtherTargetApplication({0x47,0x54,0xDE,0xAD});
+}
+
+void GenericTarget::RestartOtherTargetApplication(bool rotate){
+    SendToOtherTargetApplication({0x47,0x54,0xB0,static_cast<uint8_t>(rotate ? 0x7D : 0x07)});
+}
+
+void GenericTarget::DumpTraceOfOtherTargetApplication(void){
+    SendToOtherTargetApplication({0x47,0x54,0x7A,0xCE});
+}
+
+void GenericTarget::SendToOtherTargetApplication(const std::array<uint8_t,4>& message){
     // Open the application socket with a random port
     if(!appSocket.Open()){
         GENERIC_TARGET_PRINT_ERROR("Could not open application socket: %s\n", appSocket.GetLastErrorString().c_str());
@@ -234,15 +330,20 @@ void GenericTarget::StopOtherTargetApplication(void){
         GENERIC_TARGET_PRINT_WARNING("Unable to bind a random port for the application socket: %s\n", appSocket.GetLastErrorString().c_str());
     }
 
-    // Send termination message and close socket
+    // Send message and close socket
     Address localHost(127, 0, 0, 1, SimulinkInterface::portAppSocket);
-    const uint8_t msgTerminate[] = {0x47,0x54,0xDE,0xAD};
-    if(sizeof(msgTerminate) != appSocket.SendTo(localHost, (uint8_t*)&msgTerminate[0], sizeof(msgTerminate))){
-        GENERIC_TARGET_PRINT_WARNING("Could not send termination message: %s\n", appSocket.GetLastErrorString().c_str());
+    if(static_cast<int32_t>(message.size()) != appSocket.SendTo(localHost, (uint8_t*)&message[0], static_cast<int32_t>(message.size()))){
+        GENERIC_TARGET_PRINT_WARNING("Could not send message: %s\n", appSocket.GetLastErrorString().c_str());
     }
     appSocket.Close();
 }
 
+void GenericTarget::RequestTraceDump(void){
+    Address localHost(127, 0, 0, 1, SimulinkInterface::portAppSocket);
+    const uint8_t msgTrace[] = {0x47,0x54,0x7A,0xCE};
+    (void) appSocket.SendTo(localHost, (uint8_t*)&msgTrace[0], sizeof(msgTrace));
+}
+
 bool GenericTarget::InitializeAppSocket(void){
     // Open the application socket
     if(!appSocket.Open()){
@@ -266,6 +367,7 @@ bool GenericTarget::InitializeModel(void){
     if(!udpUnicastManager.Create()){
         return false;
     }
+    scheduler.RegisterTickSync();
     GENERIC_TARGET_PRINT("Creating multicast UDP sockets\n");
     if(!udpMulticastManager.Create()){
         return false;
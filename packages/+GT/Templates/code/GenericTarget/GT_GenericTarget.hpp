@@ -5,6 +5,8 @@
 #include <GenericTarget/GT_BaseRateScheduler.hpp>
 #include <GenericTarget/GT_ApplicationArguments.hpp>
 #include <GenericTarget/GT_FileSystem.hpp>
+#include <GenericTarget/GT_RealTimeMemory.hpp>
+#include <GenericTarget/GT_Trace.hpp>
 #include <GenericTarget/DataRecorder/GT_DataRecorderManager.hpp>
 #include <GenericTarget/Network/GT_UDPUnicastManager.hpp>
 #include <GenericTarget/Network/GT_UDPMulticastManager.hpp>
@@ -50,6 +52,24 @@ class GenericTarget {
          */
         static inline uint64_t GetNumLostTicks(void){ return scheduler.GetNumLostTicks(); }
 
+        /**
+         * @brief Get the phase error of the latest tick of the master clock with respect to the aligned reference clock (UTC or TAI).
+         * @return Phase error in seconds (positive if the tick is late) or zero if the master clock is not aligned.
+         */
+        static inline double GetPhaseError(void){ return scheduler.GetPhaseError(); }
+
+        /**
+         * @brief Get the histogram of absolute phase errors of the master clock since the start of the base-rate scheduler.
+         * @return Histogram of absolute phase errors (only recorded if the master clock is aligned).
+         */
+        static inline const LatencyHistogram& GetPhaseErrorHistogram(void){ return scheduler.GetPhaseErrorHistogram(); }
+
+        /**
+         * @brief Get a consistent snapshot of the tick synchronization status.
+         * @return The tick synchronization status (phase error, lock status, period adjustment, number of beacons).
+         */
+        static inline TickSyncStatus GetTickSyncStatus(void){ return scheduler.GetTickSyncStatus(); }
+
         /**
          * @brief Get the latest task execution time for a task.
          * @param [in] taskID The ID of the task from which to obtain the latest task execution time.
@@ -58,6 +78,22 @@ class GenericTarget {
          */
         static inline double GetTaskExecutionTime(const uint32_t taskID){ return scheduler.GetTaskExecutionTime(taskID); }
 
+        /**
+         * @brief Get the latest CPU time for a task.
+         * @param [in] taskID The ID of the task from which to obtain the latest CPU time.
+         * @return The CPU time of the thread during the latest step in seconds or a negative value if the taskID is invalid.
+         * @details The difference between the task execution time and the CPU time is the time during which the thread was preempted.
+         */
+        static inline double GetTaskCPUTime(const uint32_t taskID){ return scheduler.GetTaskCPUTime(taskID); }
+
+        /**
+         * @brief Get a consistent snapshot of the execution time statistics for a task.
+         * @param [in] taskID The ID of the task from which to obtain the statistics.
+         * @param [out] statistics The snapshot of the execution time statistics (min, max, mean, variance, percentiles, last value, number of steps over budget, CPU time, preempted time and resource usage).
+         * @return True if success, false if the taskID is invalid.
+         */
+        static inline bool GetTaskExecutionTimeStatistics(const uint32_t taskID, TaskStatisticsSnapshot& statistics){ return scheduler.GetTaskExecutionTimeStatistics(taskID, statistics); }
+
         /**
          * @brief Get the number of task overloads for a task.
          * @param [in] taskID The ID of the task from which to obtain the latest number of task overloads.
@@ -65,6 +101,64 @@ class GenericTarget {
          */
         static inline uint64_t GetNumTaskOverloads(const uint32_t taskID){ return scheduler.GetNumTaskOverloads(taskID); }
 
+        /**
+         * @brief Get the number of lost activations for a task.
+         * @param [in] taskID The ID of the task from which to obtain the number of lost activations.
+         * @return The number of activations that have been dropped according to the overrun policy of the task or zero if the taskID is invalid.
+         */
+        static inline uint64_t GetNumLostActivations(const uint32_t taskID){ return scheduler.GetNumLostActivations(taskID); }
+
+        /**
+         * @brief Get the histogram of wakeup latencies of the master thread since the start of the base-rate scheduler.
+         * @return Histogram of wakeup latencies (actual wakeup vs. ideal expiry of the master clock).
+         */
+        static inline const LatencyHistogram& GetWakeupLatencyHistogram(void){ return scheduler.GetWakeupLatencyHistogram(); }
+
+        /**
+         * @brief Get the histogram of start latencies for a task.
+         * @param [in] taskID The ID of the task from which to obtain the histogram.
+         * @return Pointer to the histogram of start latencies (notification to start of step function) or nullptr if the taskID is invalid.
+         */
+        static inline const LatencyHistogram* GetTaskStartLatencyHistogram(const uint32_t taskID){ return scheduler.GetTaskStartLatencyHistogram(taskID); }
+
+        /**
+         * @brief Get the histogram of task execution times for a task.
+         * @param [in] taskID The ID of the task from which to obtain the histogram.
+         * @return Pointer to the histogram of task execution times or nullptr if the taskID is invalid.
+         */
+        static inline const LatencyHistogram* GetTaskExecutionTimeHistogram(const uint32_t taskID){ return scheduler.GetTaskExecutionTimeHistogram(taskID); }
+
+        /**
+         * @brief Get the number of workers of the worker pool.
+         * @return Number of workers or zero if the worker pool is not used.
+         */
+        static inline uint32_t GetNumWorkers(void){ return scheduler.GetNumWorkers(); }
+
+        /**
+         * @brief Get the number of hung steps that have been detected by the watchdog.
+         * @return Number of steps that took longer than the watchdog timeout.
+         */
+        static inline uint64_t GetNumHungSteps(void){ return scheduler.GetNumHungSteps(); }
+
+        /**
+         * @brief Get the current mode of the load shedding.
+         * @return The current mode (degraded if sheddable tasks are slowed down and the data recorders are throttled).
+         */
+        static inline load_shedding_mode GetLoadSheddingMode(void){ return scheduler.GetLoadSheddingMode(); }
+
+        /**
+         * @brief Get the number of transitions to the degraded mode of the load shedding.
+         * @return Number of degradations since the start of the base-rate scheduler.
+         */
+        static inline uint64_t GetNumDegradations(void){ return scheduler.GetNumDegradations(); }
+
+        /**
+         * @brief Get the utilization of a worker of the worker pool.
+         * @param [in] workerID The ID of the worker.
+         * @return Ratio of the time the worker executed steps to the elapsed time since the start or a negative value if the workerID is invalid.
+         */
+        static inline double GetWorkerUtilization(const uint32_t workerID){ return scheduler.GetWorkerUtilization(workerID); }
+
         /**
          * @brief Call this function if the generic target application is to be terminated.
          */
@@ -105,6 +199,14 @@ class GenericTarget {
          */
         static void MainLoop(void);
 
+        /**
+         * @brief Restart the simulink model without restarting the application.
+         * @param [in] rotate True if the data recorders should continue in a new data recording directory, false if they should continue to write to the current data files.
+         * @return True if success, false if the application should be terminated.
+         * @details The scheduler is stopped, the model is terminated and initialized again and the scheduler is started. UDP sockets, the application socket and locked memory are kept.
+         */
+        static bool RestartModel(bool rotate);
+
         /**
          * @brief Set signal handlers to handle signals from the OS like SIGINT, SIGTERM.
          */
@@ -150,6 +252,29 @@ class GenericTarget {
          */
         static void StopOtherTargetApplication(void);
 
+        /**
+         * @brief Restart the model of another possibly ongoing target application by sending a restart message to the application port.
+         * @param [in] rotate True if the other application should also start a new data recording directory.
+         */
+        static void RestartOtherTargetApplication(bool rotate);
+
+        /**
+         * @brief Request a trace dump from another possibly ongoing target application by sending a trace message to the application port.
+         */
+        static void DumpTraceOfOtherTargetApplication(void);
+
+        /**
+         * @brief Send a message to the application port of another possibly ongoing target application.
+         * @param [in] message The message to be sent.
+         */
+        static void SendToOtherTargetApplication(const std::array<uint8_t,4>& message);
+
+        /**
+         * @brief Request a trace dump from this application by sending a trace message to the own application port.
+         * @details This function only calls sendto and can therefore be called from a signal handler. The trace is dumped by the main loop.
+         */
+        static void RequestTraceDump(void);
+
         /**
          * @brief Initialize the application socket.
          * @return True if success, false otherwise.
@@ -0,0 +1,225 @@
+#include <GenericTarget/GT_IOUring.hpp>
+using namespace gt;
+
+
+IOUring::IOUring(){
+    ringFD = -1;
+    numEntries = 0;
+    sqeTail = 0;
+    numPrepared = 0;
+    sqMemory = nullptr;
+    sqMemorySize = 0;
+    cqMemory = nullptr;
+    cqMemorySize = 0;
+    sqeMemory = nullptr;
+    sqeMemorySize = 0;
+    sqHead = nullptr;
+    sqTail = nullptr;
+    sqMask = nullptr;
+    sqArray = nullptr;
+    cqHead = nullptr;
+    cqTail = nullptr;
+    cqMask = nullptr;
+    #ifndef _WIN32
+    sqes = nullptr;
+    cqes = nullptr;
+    #endif
+}
+
+IOUring::~IOUring(){
+    Destroy();
+}
+
+bool IOUring::Create(uint32_t numEntries){
+    Destroy();
+    #ifdef _WIN32
+    (void) numEntries;
+    return false;
+    #else
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(syscall(__NR_io_uring_setup, numEntries, &params));
+    if(fd < 0){
+        return false;
+    }
+    ringFD = fd;
+
+    // Map the submission queue ring, the completion queue ring and the submission queue entries
+    sqMemorySize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cqMemorySize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    const bool singleMap = (0 != (params.features & IORING_FEAT_SINGLE_MMAP));
+    if(singleMap){
+        sqMemorySize = cqMemorySize = std::max(sqMemorySize, cqMemorySize);
+    }
+    sqMemory = mmap(nullptr, sqMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFD, IORING_OFF_SQ_RING);
+    if(MAP_FAILED == sqMemory){
+        sqMemory = nullptr;
+        Destroy();
+        return false;
+    }
+    if(singleMap){
+        cqMemory = sqMemory;
+    }
+    else{
+        cqMemory = mmap(nullptr, cqMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFD, IORING_OFF_CQ_RING);
+        if(MAP_FAILED == cqMemory){
+            cqMemory = nullptr;
+            Destroy();
+            return false;
+        }
+    }
+    sqeMemorySize = params.sq_entries * sizeof(struct io_uring_sqe);
+    sqeMemory = mmap(nullptr, sqeMemorySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFD, IORING_OFF_SQES);
+    if(MAP_FAILED == sqeMemory){
+        sqeMemory = nullptr;
+        Destroy();
+        return false;
+    }
+
+    // Pointers to the shared ring fields
+    uint8_t* sq = static_cast<uint8_t*>(sqMemory);
+    uint8_t* cq = static_cast<uint8_t*>(cqMemory);
+    sqHead = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+    sqTail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+    sqMask = reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+    sqArray = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+    cqHead = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+    cqTail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+    cqMask = reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+    sqes = static_cast<struct io_uring_sqe*>(sqeMemory);
+    cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+    this->numEntries = params.sq_entries;
+    sqeTail = *sqTail;
+    numPrepared = 0;
+    return true;
+    #endif
+}
+
+void IOUring::Destroy(void){
+    #ifndef _WIN32
+    if(sqeMemory){
+        (void) munmap(sqeMemory, sqeMemorySize);
+    }
+    if(cqMemory && (cqMemory != sqMemory)){
+        (void) munmap(cqMemory, cqMemorySize);
+    }
+    if(sqMemory){
+        (void) munmap(sqMemory, sqMemorySize);
+    }
+    if(ringFD >= 0){
+        (void) close(ringFD);
+    }
+    sqes = nullptr;
+    cqes = nullptr;
+    #endif
+    ringFD = -1;
+    numEntries = 0;
+    sqeTail = 0;
+    numPrepared = 0;
+    sqMemory = nullptr;
+    sqMemorySize = 0;
+    cqMemory = nullptr;
+    cqMemorySize = 0;
+    sqeMemory = nullptr;
+    sqeMemorySize = 0;
+    sqHead = nullptr;
+    sqTail = nullptr;
+    sqMask = nullptr;
+    sqArray = nullptr;
+    cqHead = nullptr;
+    cqTail = nullptr;
+    cqMask = nullptr;
+}
+
+#ifndef _WIN32
+bool IOUring::PrepareWritev(int fd, const struct iovec* iov, uint32_t numIov, uint64_t offset, uint64_t userData){
+    if(!IsCreated() || ((sqeTail - std::atomic_ref<uint32_t>(*sqHead).load(std::memory_order_acquire)) >= numEntries)){
+        return false;
+    }
+    const uint32_t index = sqeTail & *sqMask;
+    struct io_uring_sqe* sqe = &sqes[index];
+    std::memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode = IORING_OP_WRITEV;
+    sqe->fd = fd;
+    sqe->off = offset;
+    sqe->addr = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(iov));
+    sqe->len = numIov;
+    sqe->user_data = userData;
+    sqArray[index] = index;
+    sqeTail++;
+    numPrepared++;
+    return true;
+}
+#endif
+
+uint32_t IOUring::Submit(void){
+    uint32_t numSubmitted = 0;
+    #ifndef _WIN32
+    if(!IsCreated()){
+        return 0;
+    }
+
+    // Publish all prepared entries, the kernel may accept fewer entries than requested
+    std::atomic_ref<uint32_t>(*sqTail).store(sqeTail, std::memory_order_release);
+    while(numSubmitted < numPrepared){
+        int result = static_cast<int>(syscall(__NR_io_uring_enter, ringFD, numPrepared - numSubmitted, 0, 0, nullptr, 0));
+        if(result > 0){
+            numSubmitted += static_cast<uint32_t>(result);
+        }
+        else if((result < 0) && (EINTR == errno)){
+            continue;
+        }
+        else{
+            break;
+        }
+    }
+
+    // Entries that have not been accepted are the newest ones, they are taken back (the kernel only reads the tail during io_uring_enter)
+    if(numSubmitted < numPrepared){
+        sqeTail -= (numPrepared - numSubmitted);
+        std::atomic_ref<uint32_t>(*sqTail).store(sqeTail, std::memory_order_release);
+    }
+    numPrepared = 0;
+    #endif
+    return numSubmitted;
+}
+
+bool IOUring::Wait(uint32_t numCompletions){
+    #ifdef _WIN32
+    (void) numCompletions;
+    return false;
+    #else
+    if(!IsCreated()){
+        return false;
+    }
+    while((std::atomic_ref<uint32_t>(*cqTail).load(std::memory_order_acquire) - std::atomic_ref<uint32_t>(*cqHead).load(std::memory_order_relaxed)) < numCompletions){
+        int result = static_cast<int>(syscall(__NR_io_uring_enter, ringFD, 0, numCompletions, IORING_ENTER_GETEVENTS, nullptr, 0));
+        if((result < 0) && (EINTR != errno)){
+            return false;
+        }
+    }
+    return true;
+    #endif
+}
+
+bool IOUring::PopCompletion(uint64_t& userData, int32_t& result){
+    #ifdef _WIN32
+    (void) userData;
+    (void) result;
+    return false;
+    #else
+    if(!IsCreated()){
+        return false;
+    }
+    const uint32_t head = std::atomic_ref<uint32_t>(*cqHead).load(std::memory_order_relaxed);
+    if(head == std::atomic_ref<uint32_t>(*cqTail).load(std::memory_order_acquire)){
+        return false;
+    }
+    const struct io_uring_cqe* cqe = &cqes[head & *cqMask];
+    userData = cqe->user_data;
+    result = cqe->res;
+    std::atomic_ref<uint32_t>(*cqHead).store(head + 1, std::memory_order_release);
+    return true;
+    #endif
+}
+
@@ -0,0 +1,114 @@
+#pragma once
+
+
+#include <GenericTarget/GT_Common.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief This class represents a minimal io_uring instance for vectored file writes. The submission and completion queues are shared with the kernel
+ * via memory mappings, such that many writes can be submitted and reaped with a single system call. The io_uring system calls are used directly,
+ * no additional library is required.
+ * @details On windows or if the kernel does not support io_uring, @ref Create fails and the caller must fall back to synchronous writes.
+ * All member functions must be called by the same thread.
+ */
+class IOUring {
+    public:
+        /**
+         * @brief Create an io_uring object. No io_uring instance is created.
+         */
+        IOUring();
+
+        /**
+         * @brief Destroy the io_uring instance.
+         */
+        ~IOUring();
+
+        /**
+         * @brief Create the io_uring instance.
+         * @param [in] numEntries Minimum number of entries of the submission queue, rounded up to a power of two by the kernel.
+         * @return True if success, false if io_uring is not supported.
+         */
+        bool Create(uint32_t numEntries);
+
+        /**
+         * @brief Destroy the io_uring instance.
+         * @details This function has no effect if no io_uring instance has been created.
+         */
+        void Destroy(void);
+
+        /**
+         * @brief Check whether an io_uring instance has been created.
+         * @return True if an io_uring instance has been created, false otherwise.
+         */
+        inline bool IsCreated(void) const { return (ringFD >= 0); }
+
+        /**
+         * @brief Get the number of entries of the submission queue.
+         * @return Maximum number of writes that can be prepared before they are submitted.
+         */
+        inline uint32_t GetNumEntries(void) const { return numEntries; }
+
+        #ifndef _WIN32
+        /**
+         * @brief Prepare a vectored write. The write is not started until @ref Submit is called.
+         * @param [in] fd File descriptor of the file to be written.
+         * @param [in] iov Buffers to be written. The buffers must remain valid until the write has been completed.
+         * @param [in] numIov Number of buffers.
+         * @param [in] offset File offset in bytes at which the buffers are written.
+         * @param [in] userData User data that is returned with the completion of this write.
+         * @return True if success, false if the submission queue is full.
+         */
+        bool PrepareWritev(int fd, const struct iovec* iov, uint32_t numIov, uint64_t offset, uint64_t userData);
+        #endif
+
+        /**
+         * @brief Submit all prepared writes to the kernel.
+         * @return Number of writes that have been submitted. Prepared writes that have not been accepted by the kernel are discarded.
+         */
+        uint32_t Submit(void);
+
+        /**
+         * @brief Wait until a number of completions is available.
+         * @param [in] numCompletions Number of completions to wait for.
+         * @return True if success, false if an error occurred.
+         */
+        bool Wait(uint32_t numCompletions);
+
+        /**
+         * @brief Remove the oldest completion from the completion queue.
+         * @param [out] userData User data of the completed write.
+         * @param [out] result Number of bytes written or a negative error number.
+         * @return True if a completion has been removed, false if the completion queue is empty.
+         */
+        bool PopCompletion(uint64_t& userData, int32_t& result);
+
+    private:
+        int ringFD;                         ///< File descriptor of the io_uring instance or a negative value if no instance has been created.
+        uint32_t numEntries;                ///< Number of entries of the submission queue.
+        uint32_t sqeTail;                   ///< Local tail of the submission queue including all prepared writes.
+        uint32_t numPrepared;               ///< Number of writes that have been prepared but not yet submitted.
+        void* sqMemory;                     ///< Mapped memory of the submission queue ring.
+        size_t sqMemorySize;                ///< Size of the mapped memory of the submission queue ring.
+        void* cqMemory;                     ///< Mapped memory of the completion queue ring (equal to @ref sqMemory if the kernel maps both rings at once).
+        size_t cqMemorySize;                ///< Size of the mapped memory of the completion queue ring.
+        void* sqeMemory;                    ///< Mapped memory of the submission queue entries.
+        size_t sqeMemorySize;               ///< Size of the mapped memory of the submission queue entries.
+        uint32_t* sqHead;                   ///< Head of the submission queue (written by the kernel).
+        uint32_t* sqTail;                   ///< Tail of the submission queue (written by the application).
+        uint32_t* sqMask;                   ///< Index mask of the submission queue.
+        uint32_t* sqArray;                  ///< Indices of the submission queue entries.
+        uint32_t* cqHead;                   ///< Head of the completion queue (written by the application).
+        uint32_t* cqTail;                   ///< Tail of the completion queue (written by the kernel).
+        uint32_t* cqMask;                   ///< Index mask of the completion queue.
+        #ifndef _WIN32
+        struct io_uring_sqe* sqes;          ///< Submission queue entries.
+        struct io_uring_cqe* cqes;          ///< Completion queue entries.
+        #endif
+};
+
+
+} /* namespace: gt */
+
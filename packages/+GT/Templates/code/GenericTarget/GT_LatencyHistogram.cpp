@@ -0,0 +1,84 @@
+#include <GenericTarget/GT_LatencyHistogram.hpp>
+using namespace gt;
+
+
+LatencyHistogram::LatencyHistogram(){
+    Reset();
+}
+
+void LatencyHistogram::Reset(void){
+    for(auto&& b : buckets){
+        b = 0;
+    }
+    count = 0;
+    sum = 0;
+    minimum = std::numeric_limits<uint64_t>::max();
+    maximum = 0;
+}
+
+void LatencyHistogram::Record(int64_t nanoseconds){
+    uint64_t value = (nanoseconds > 0) ? static_cast<uint64_t>(nanoseconds) : 0;
+    buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+    if(value < minimum.load(std::memory_order_relaxed)){
+        minimum.store(value, std::memory_order_relaxed);
+    }
+    if(value > maximum.load(std::memory_order_relaxed)){
+        maximum.store(value, std::memory_order_relaxed);
+    }
+    count.fetch_add(1, std::memory_order_release);
+}
+
+double LatencyHistogram::GetMin(void) const {
+    return GetCount() ? (1e-9 * double(minimum.load(std::memory_order_relaxed))) : 0.0;
+}
+
+double LatencyHistogram::GetMax(void) const {
+    return 1e-9 * double(maximum.load(std::memory_order_relaxed));
+}
+
+double LatencyHistogram::GetMean(void) const {
+    uint64_t n = GetCount();
+    return n ? (1e-9 * double(sum.load(std::memory_order_relaxed)) / double(n)) : 0.0;
+}
+
+double LatencyHistogram::GetPercentile(double percent) const {
+    // Take a snapshot of all buckets, the total count may change while reading at runtime
+    std::array<uint64_t, numBuckets> snapshot;
+    uint64_t total = 0;
+    for(uint32_t b = 0; b < numBuckets; ++b){
+        snapshot[b] = buckets[b].load(std::memory_order_relaxed);
+        total += snapshot[b];
+    }
+    if(!total){
+        return 0.0;
+    }
+
+    // Find the bucket that contains the percentile and return its upper bound
+    percent = std::clamp(percent, 0.0, 100.0);
+    uint64_t rank = std::max(uint64_t(1), static_cast<uint64_t>(std::ceil(0.01 * percent * double(total))));
+    uint64_t largest = maximum.load(std::memory_order_relaxed);
+    uint64_t accumulated = 0;
+    for(uint32_t b = 0; b < numBuckets; ++b){
+        accumulated += snapshot[b];
+        if(accumulated >= rank){
+            uint64_t upperBound = ((b + 1) < numBuckets) ? (GetBucketLowerBound(b + 1) - 1) : largest;
+            return 1e-9 * double(std::min(upperBound, largest));
+        }
+    }
+    return 1e-9 * double(largest);
+}
+
+uint64_t LatencyHistogram::GetBucketLowerBound(uint32_t bucket){
+    if(bucket < numSubBuckets){
+        return bucket;
+    }
+    uint32_t exponent = bucket / numSubBuckets + numSubBucketBits - 1;
+    uint64_t subBucket = bucket % numSubBuckets;
+    return (numSubBuckets + subBucket) << (exponent - numSubBucketBits);
+}
+
+void LatencyHistogram::Print(const char* name) const {
+    GENERIC_TARGET_PRINT("%s: count=%lu, min=%.3lf us, mean=%.3lf us, p50=%.3lf us, p99=%.3lf us, p99.9=%.3lf us, max=%.3lf us\n", name, GetCount(), 1e6 * GetMin(), 1e6 * GetMean(), 1e6 * GetPercentile(50.0), 1e6 * GetPercentile(99.0), 1e6 * GetPercentile(99.9), 1e6 * GetMax());
+}
+
@@ -0,0 +1,117 @@
+#pragma once
+
+
+#include <GenericTarget/GT_Common.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief The latency histogram counts time values (nanoseconds) in logarithmic buckets, similar to HdrHistogram. Each power of two is divided into
+ * @ref numSubBuckets linear sub-buckets, which results in a relative bucket width of less than 6.25 percent. All buckets are preallocated, such that
+ * @ref Record does not allocate memory and is lock-free. Exactly one thread is allowed to record values, while any thread may read the histogram at runtime.
+ */
+class LatencyHistogram {
+    public:
+        static constexpr uint32_t numSubBucketBits = 4;                                               ///< Number of bits for the linear sub-buckets within one power of two.
+        static constexpr uint32_t numSubBuckets = (1 << numSubBucketBits);                            ///< Number of linear sub-buckets within one power of two.
+        static constexpr uint32_t maxExponent = 40;                                                   ///< Values greater than or equal to 2^(maxExponent + 1) nanoseconds (about 36 minutes) are counted in the last bucket.
+        static constexpr uint32_t numBuckets = numSubBuckets * (maxExponent - numSubBucketBits + 2);  ///< Total number of buckets.
+
+        /**
+         * @brief Create an empty latency histogram.
+         */
+        LatencyHistogram();
+
+        /**
+         * @brief Reset the histogram, e.g. remove all recorded values.
+         * @details This function must not be called while another thread records values.
+         */
+        void Reset(void);
+
+        /**
+         * @brief Record a time value.
+         * @param [in] nanoseconds The time value in nanoseconds. Negative values are counted as zero.
+         */
+        void Record(int64_t nanoseconds);
+
+        /**
+         * @brief Get the number of recorded values.
+         * @return Number of recorded values.
+         */
+        inline uint64_t GetCount(void) const { return count.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Get the smallest recorded value.
+         * @return Smallest recorded value in seconds or zero if no value has been recorded.
+         */
+        double GetMin(void) const;
+
+        /**
+         * @brief Get the largest recorded value.
+         * @return Largest recorded value in seconds or zero if no value has been recorded.
+         */
+        double GetMax(void) const;
+
+        /**
+         * @brief Get the mean of all recorded values.
+         * @return Mean value in seconds or zero if no value has been recorded.
+         */
+        double GetMean(void) const;
+
+        /**
+         * @brief Get a percentile of all recorded values.
+         * @param [in] percent The percentage in range [0, 100], e.g. 99.9.
+         * @return The upper bound of the bucket containing the percentile in seconds or zero if no value has been recorded. The result is limited to the largest recorded value.
+         */
+        double GetPercentile(double percent) const;
+
+        /**
+         * @brief Get the number of values that have been counted in a bucket.
+         * @param [in] bucket The bucket index in range [0, @ref numBuckets).
+         * @return The number of values in the bucket or zero if the index is out of range.
+         */
+        inline uint64_t GetBucketCount(uint32_t bucket) const { return (bucket < numBuckets) ? buckets[bucket].load(std::memory_order_relaxed) : 0; }
+
+        /**
+         * @brief Get the lower bound of a bucket.
+         * @param [in] bucket The bucket index in range [0, @ref numBuckets).
+         * @return The smallest value in nanoseconds that is counted in the bucket.
+         */
+        static uint64_t GetBucketLowerBound(uint32_t bucket);
+
+        /**
+         * @brief Print a summary (count, min, mean, percentiles, max) of the histogram in microseconds.
+         * @param [in] name The name to be printed in front of the summary.
+         */
+        void Print(const char* name) const;
+
+    private:
+        std::array<std::atomic<uint64_t>, numBuckets> buckets;   ///< Number of recorded values for each bucket.
+        std::atomic<uint64_t> count;                             ///< Total number of recorded values.
+        std::atomic<uint64_t> sum;                               ///< Sum of all recorded values in nanoseconds.
+        std::atomic<uint64_t> minimum;                           ///< Smallest recorded value in nanoseconds.
+        std::atomic<uint64_t> maximum;                           ///< Largest recorded value in nanoseconds.
+
+        /**
+         * @brief Get the bucket index for a value.
+         * @param [in] value The value in nanoseconds.
+         * @return The bucket index in range [0, @ref numBuckets).
+         */
+        static inline uint32_t GetBucketIndex(uint64_t value){
+            if(value < numSubBuckets){
+                return static_cast<uint32_t>(value);
+            }
+            uint32_t exponent = static_cast<uint32_t>(std::bit_width(value)) - 1;
+            if(exponent > maxExponent){
+                return numBuckets - 1;
+            }
+            uint32_t subBucket = static_cast<uint32_t>(value >> (exponent - numSubBucketBits)) & (numSubBuckets - 1);
+            return numSubBuckets * (exponent - numSubBucketBits + 1) + subBucket;
+        }
+};
+
+
+} /* namespace: gt */
+
@@ -0,0 +1,101 @@
+#include <GenericTarget/GT_LoadShedding.hpp>
+#include <GenericTarget/GT_GenericTarget.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
+using namespace gt;
+
+
+LoadShedding::LoadShedding(){
+    active = false;
+    ticksPerWindow = 1;
+    ticksOfWindow = 0;
+    previousOverloads = 0;
+    numOverloadedWindows = 0;
+    numCleanWindows = 0;
+    mode = load_shedding_mode::NORMAL;
+    numDegradations = 0;
+}
+
+LoadShedding::~LoadShedding(){
+    Stop();
+}
+
+void LoadShedding::Start(const std::vector<PeriodicTask*>& tasks){
+    Stop();
+    numDegradations = 0;
+    if(!SimulinkInterface::loadShedding){
+        return;
+    }
+    this->tasks = tasks;
+    ticksPerWindow = std::max(uint64_t(1), static_cast<uint64_t>(std::llround(GENERIC_TARGET_LOAD_SHEDDING_WINDOW / SimulinkInterface::baseSampleTime)));
+    ticksOfWindow = 0;
+    previousOverloads = GetNumOverloads(0);
+    numOverloadedWindows = 0;
+    numCleanWindows = 0;
+    active = true;
+}
+
+void LoadShedding::Stop(void){
+    if(active){
+        SetMode(load_shedding_mode::NORMAL);
+        GENERIC_TARGET_PRINT("Load shedding has been stopped (%lu degradations)\n", numDegradations.load());
+    }
+    active = false;
+    tasks.clear();
+}
+
+void LoadShedding::Update(uint64_t numCPUOverloads){
+    if(!active || ((++ticksOfWindow) < ticksPerWindow)){
+        return;
+    }
+    ticksOfWindow = 0;
+
+    // A window is overloaded if any overload counter has been incremented
+    uint64_t numOverloads = GetNumOverloads(numCPUOverloads);
+    bool overloaded = (numOverloads != previousOverloads);
+    previousOverloads = numOverloads;
+    if(overloaded){
+        numOverloadedWindows++;
+        numCleanWindows = 0;
+    }
+    else{
+        numCleanWindows++;
+        numOverloadedWindows = 0;
+    }
+
+    // Degrade after sustained overload, restore after sustained recovery
+    if((load_shedding_mode::NORMAL == mode) && (numOverloadedWindows >= GENERIC_TARGET_LOAD_SHEDDING_ENTER_WINDOWS)){
+        SetMode(load_shedding_mode::DEGRADED);
+        numDegradations++;
+        GENERIC_TARGET_PRINT_WARNING("Sustained overload: load shedding degrades sheddable tasks and data recorders by factor %u\n", SimulinkInterface::loadSheddingFactor);
+        previousOverloads = GetNumOverloads(numCPUOverloads);
+    }
+    else if((load_shedding_mode::DEGRADED == mode) && (numCleanWindows >= GENERIC_TARGET_LOAD_SHEDDING_EXIT_WINDOWS)){
+        SetMode(load_shedding_mode::NORMAL);
+        GENERIC_TARGET_PRINT("Overload has been recovered: load shedding restored the nominal rates\n");
+        previousOverloads = GetNumOverloads(numCPUOverloads);
+    }
+}
+
+uint64_t LoadShedding::GetNumOverloads(uint64_t numCPUOverloads){
+    uint64_t sum = numCPUOverloads;
+    const bool degraded = (load_shedding_mode::DEGRADED == mode);
+    for(auto&& task : tasks){
+        sum += task->GetNumTaskOverloads();
+        if(!degraded || !SimulinkInterface::sheddable[task->taskID]){
+            sum += task->GetNumOverBudget();
+        }
+    }
+    return sum;
+}
+
+void LoadShedding::SetMode(load_shedding_mode newMode){
+    mode = newMode;
+    const uint32_t factor = (load_shedding_mode::DEGRADED == newMode) ? SimulinkInterface::loadSheddingFactor : 1;
+    for(auto&& task : tasks){
+        if(SimulinkInterface::sheddable[task->taskID]){
+            task->SetSampleTickStretch(factor);
+        }
+    }
+    GenericTarget::dataRecorderManager.SetDecimation(factor);
+}
+
@@ -0,0 +1,96 @@
+#pragma once
+
+
+#include <GenericTarget/GT_PeriodicTask.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief This enumeration represents the mode of the load shedding.
+ */
+enum class load_shedding_mode : uint8_t {
+    NORMAL = 0,               ///< All tasks run at their nominal rates and all samples are recorded.
+    DEGRADED = 1              ///< The rates of sheddable tasks are slowed down and the data recorders are throttled.
+};
+
+
+/**
+ * @brief The load shedding degrades the system gracefully under sustained overload instead of terminating it. The base-rate scheduler evaluates
+ * the overload counters of the master clock and all tasks in windows of fixed length. If several consecutive windows contain CPU overloads, task
+ * overloads or steps over budget, the sample ticks of all sheddable tasks are stretched by the load shedding factor and the data recorders only
+ * record every N-th sample. After a number of clean windows, the nominal rates are restored. All transitions are logged.
+ */
+class LoadShedding {
+    public:
+        /**
+         * @brief Create the load shedding.
+         */
+        LoadShedding();
+
+        /**
+         * @brief Restore the nominal rates.
+         */
+        ~LoadShedding();
+
+        /**
+         * @brief Start the load shedding in normal mode.
+         * @param [in] tasks All periodic tasks. The tasks must not be deleted before @ref Stop is called.
+         * @details The load shedding is not started if it is disabled.
+         */
+        void Start(const std::vector<PeriodicTask*>& tasks);
+
+        /**
+         * @brief Stop the load shedding and restore the nominal rates.
+         */
+        void Stop(void);
+
+        /**
+         * @brief Update the load shedding after a tick of the master clock.
+         * @param [in] numCPUOverloads The number of CPU overloads of the master clock.
+         * @details This function must be called by the thread that waits for the ticks of the master clock.
+         */
+        void Update(uint64_t numCPUOverloads);
+
+        /**
+         * @brief Get the current mode of the load shedding.
+         * @return The current mode.
+         */
+        inline load_shedding_mode GetMode(void){ return mode; }
+
+        /**
+         * @brief Get the number of transitions to the degraded mode since @ref Start.
+         * @return Number of degradations.
+         */
+        inline uint64_t GetNumDegradations(void){ return numDegradations; }
+
+    private:
+        bool active;                                ///< True if the load shedding has been started, false otherwise.
+        std::vector<PeriodicTask*> tasks;           ///< All periodic tasks.
+        uint64_t ticksPerWindow;                    ///< Number of base-rate ticks per window.
+        uint64_t ticksOfWindow;                     ///< Number of ticks of the current window.
+        uint64_t previousOverloads;                 ///< Sum of all overload counters at the end of the previous window.
+        uint32_t numOverloadedWindows;              ///< Number of consecutive windows that contained overloads.
+        uint32_t numCleanWindows;                   ///< Number of consecutive windows without overloads.
+        std::atomic<load_shedding_mode> mode;       ///< The current mode.
+        std::atomic<uint64_t> numDegradations;      ///< Number of transitions to the degraded mode.
+
+        /**
+         * @brief Get the sum of all overload counters.
+         * @param [in] numCPUOverloads The number of CPU overloads of the master clock.
+         * @return Sum of CPU overloads, task overloads and steps over budget.
+         * @details In degraded mode, the steps over budget of sheddable tasks are ignored, because a slower rate does not shorten a step.
+         */
+        uint64_t GetNumOverloads(uint64_t numCPUOverloads);
+
+        /**
+         * @brief Set the mode and apply it to all sheddable tasks and data recorders.
+         * @param [in] newMode The new mode.
+         */
+        void SetMode(load_shedding_mode newMode);
+};
+
+
+} /* namespace: gt */
+
@@ -1,38 +1,72 @@
 #include <GenericTarget/GT_PeriodicTask.hpp>
+#include <GenericTarget/GT_WorkerPool.hpp>
 #include <GenericTarget/GT_GenericTarget.hpp>
 #include <SimulinkCodeGeneration/SimulinkInterface.hpp>
 using namespace gt;
 
 
-PeriodicTask::PeriodicTask(const uint32_t taskID): taskID((taskID < SIMULINK_INTERFACE_NUM_TIMINGS) ? taskID : 0){
-    ticks = 1;
+PeriodicTask::PeriodicTask(const uint32_t taskID, WorkerPool* pool): taskID((taskID < SIMULINK_INTERFACE_NUM_TIMINGS) ? taskID : 0), pool(pool),
+overrunPolicy(static_cast<task_overrun_policy>(SimulinkInterface::overrunPolicies[this->taskID])),
+maxPendingActivations((task_overrun_policy::QUEUE == overrunPolicy) ? std::max(uint32_t(1), SimulinkInterface::activationQueueSizes[this->taskID]) : 1),
+executionTimeBudgetNs(static_cast<int64_t>(std::llround(1e9 * SimulinkInterface::executionTimeBudgets[this->taskID]))){
+    ticks = 1 + static_cast<int>(SimulinkInterface::sampleOffsetTicks[this->taskID]);
+    sampleTickStretch = 1;
     numTaskOverloads = 0;
+    numLostActivations = 0;
+    pendingActivations = 0;
     jobRunning = false;
     started = false;
     terminate = false;
-    notified = false;
-    taskExecutionTime = 0.0;
+    timeOfNotify = 0;
+    timeOfStepStart = 0;
+    deadlineRuntimeNs = 0;
+    inlineExecution = false;
+    freeRun = false;
+    scheduled = false;
 }
 
 PeriodicTask::~PeriodicTask(){
     Stop();
 }
 
-void PeriodicTask::Start(void){
+void PeriodicTask::Start(bool freeRun){
     // Make sure that the task is stopped
     Stop();
 
-    // Start thread
+    // Reset attributes
     started = true;
-    ticks = 1;
+    ticks = 1 + static_cast<int>(SimulinkInterface::sampleOffsetTicks[taskID]);
+    sampleTickStretch = 1;
     numTaskOverloads = 0;
-    t = std::thread(&PeriodicTask::Thread, this);
+    numLostActivations = 0;
+    pendingActivations = 0;
+    this->freeRun = freeRun;
+    inlineExecution = SimulinkInterface::inlineExecution || freeRun;
+    startLatency.Reset();
+    executionTime.Reset();
+    scheduled = false;
+
+    // Steps are executed by the worker pool or inline by the virtual master clock: no thread required
+    if(pool || freeRun){
+        return;
+    }
 
-    // Set priority
-    struct sched_param param;
-    param.sched_priority = SimulinkInterface::priorities[taskID];
-    if(0 != pthread_setschedparam(t.native_handle(), SCHED_FIFO, &param)){
-        GENERIC_TARGET_PRINT_WARNING("Could not set thread priority %d for task \"%s\" (sampletime=%lf)\n", SimulinkInterface::priorities[taskID], SimulinkInterface::taskNames[taskID], SimulinkInterface::baseSampleTime * double(SimulinkInterface::sampleTicks[taskID]));
+    // Start thread with priority and CPU affinity, the thread is named by its sampletime, e.g. "gt-task-1ms"
+    wakeupSignal.Clear();
+    char name[32];
+    double sampleTime = SimulinkInterface::baseSampleTime * double(SimulinkInterface::sampleTicks[taskID]);
+    if(sampleTime < 1e-3){
+        std::snprintf(name, sizeof(name), "gt-task-%gus", 1e6 * sampleTime);
+    }
+    else if(sampleTime < 1.0){
+        std::snprintf(name, sizeof(name), "gt-task-%gms", 1e3 * sampleTime);
+    }
+    else{
+        std::snprintf(name, sizeof(name), "gt-task-%gs", sampleTime);
+    }
+    if(!t.Start([this](){ Thread(); }, name, SimulinkInterface::priorities[taskID], SimulinkInterface::cpuAffinity[taskID])){
+        GENERIC_TARGET_PRINT_ERROR("Could not start the thread of task \"%s\" (sampletime=%lf)\n", SimulinkInterface::taskNames[taskID], sampleTime);
+        GenericTarget::ShouldTerminate();
     }
 }
 
@@ -40,34 +74,39 @@ void PeriodicTask::Stop(void){
     // Stop the thread if it is running
     terminate = true;
     if(started){
-        std::unique_lock<std::mutex> lock(mtx);
-        notified = true;
-        cv.notify_one();
+        wakeupSignal.Notify();
     }
 
     // Wait until the thread has finished
-    if(started && t.joinable()){
-        t.join();
+    if(started){
+        t.Join();
     }
 
     // Reset attributes (except missed ticks)
-    ticks = 1;
+    ticks = 1 + static_cast<int>(SimulinkInterface::sampleOffsetTicks[taskID]);
     jobRunning = false;
     started = false;
     terminate = false;
-    notified = false;
-    taskExecutionTime = 0.0;
+    deadlineRuntimeNs = 0;
 }
 
-void PeriodicTask::Notify(void){
+void PeriodicTask::Notify(int64_t timeOfTickNs){
     if(started){
         // Decrement ticks, only signal thread if tick counter is zero (or less)
         if((--ticks) < 1){
-            // Reset tick counter to specified model sample ticks
-            ticks = SimulinkInterface::sampleTicks[taskID];
+            // Reset tick counter to specified model sample ticks (stretched if the load shedding slows down the task)
+            ticks = SimulinkInterface::sampleTicks[taskID] * static_cast<int>(sampleTickStretch);
+            Trace::Event(trace_event::NOTIFY, trace_phase::INSTANT, taskID);
+
+            // Execute step function directly if inline execution is active
+            if(inlineExecution){
+                ExecuteInline(timeOfTickNs);
+                return;
+            }
 
             // If a job is still running: task overload
-            if(jobRunning){
+            bool overrun = jobRunning;
+            if(overrun){
                 uint64_t n = ++numTaskOverloads;
                 GENERIC_TARGET_PRINT_ERROR("Task overload (task=\"%s\", priority=%d, sampletime=%lf, overloads=%lu)\n", SimulinkInterface::taskNames[taskID], SimulinkInterface::priorities[taskID], SimulinkInterface::baseSampleTime * double(SimulinkInterface::sampleTicks[taskID]), n);
                 if(SimulinkInterface::terminateAtTaskOverload){
@@ -76,37 +115,134 @@ void PeriodicTask::Notify(void){
                 }
             }
 
-            // Notify the actual thread
-            {
-                std::unique_lock<std::mutex> lock(mtx);
-                notified = true;
-                cv.notify_one();
+            // Apply overrun policy: only this function increments pending activations, the thread only decrements them
+            if(overrun && (task_overrun_policy::RESTART_ALIGNED == overrunPolicy)){
+                numLostActivations += 1 + pendingActivations.exchange(0);
+                return;
+            }
+            if(pendingActivations >= maxPendingActivations){
+                ++numLostActivations;
+                return;
+            }
+            ++pendingActivations;
+
+            // Notify the actual thread or submit the task to the worker pool
+            timeOfNotify = timeOfTickNs;
+            if(pool){
+                pool->Submit(this);
+                return;
             }
+            wakeupSignal.Notify();
         }
     }
 }
 
+void PeriodicTask::SetSampleOffset(const uint32_t offsetTicks, const uint64_t tick){
+    // The next notification is the first tick after the given tick that matches the offset
+    const uint64_t period = static_cast<uint64_t>(SimulinkInterface::sampleTicks[taskID]);
+    ticks = 1 + static_cast<int>((uint64_t(offsetTicks % period) + period - ((tick + 1) % period)) % period);
+}
+
 void PeriodicTask::Thread(void){
+    Trace::RegisterThread(std::string("task ") + SimulinkInterface::taskNames[taskID]);
+
+    // Optional SCHED_DEADLINE: start with an equal share of the CPU bandwidth for all tasks, the thread keeps SCHED_FIFO if the kernel refuses
+    const uint64_t periodNs = static_cast<uint64_t>(std::llround(1e9 * SimulinkInterface::baseSampleTime * double(SimulinkInterface::sampleTicks[taskID])));
+    bool calibrateDeadline = false;
+    if(task_scheduling_policy::DEADLINE == static_cast<task_scheduling_policy>(SimulinkInterface::schedulingPolicy)){
+        if(SetDeadlineScheduling(periodNs / uint64_t(SIMULINK_INTERFACE_NUM_TIMINGS + 1))){
+            calibrateDeadline = true;
+            GENERIC_TARGET_PRINT("Task \"%s\" (sampletime=%lf) uses SCHED_DEADLINE (runtime=%lf)\n", SimulinkInterface::taskNames[taskID], 1e-9 * double(periodNs), GetDeadlineRuntime());
+        }
+        else{
+            GENERIC_TARGET_PRINT_WARNING("Kernel refused SCHED_DEADLINE for task \"%s\" (sampletime=%lf): %s, falling back to SCHED_FIFO (priority=%d)\n", SimulinkInterface::taskNames[taskID], 1e-9 * double(periodNs), strerror(errno), SimulinkInterface::priorities[taskID]);
+        }
+    }
+
     for(;;){
         // Wait for notification
-        {
-            std::unique_lock<std::mutex> lock(mtx);
-            cv.wait(lock, [this](){ return (notified || terminate); });
-            notified = false;
+        wakeupSignal.Wait();
+        RunPendingActivations(timeOfNotify);
+
+        // Derive the SCHED_DEADLINE runtime budget from the measured execution times
+        if(calibrateDeadline && (executionTime.GetHistogram().GetCount() >= GENERIC_TARGET_DEADLINE_CALIBRATION_STEPS)){
+            calibrateDeadline = false;
+            uint64_t runtimeNs = static_cast<uint64_t>(SimulinkInterface::deadlineRuntimeMargin * 1e9 * executionTime.GetHistogram().GetMax());
+            if(SetDeadlineScheduling(runtimeNs)){
+                GENERIC_TARGET_PRINT("Task \"%s\" (sampletime=%lf) calibrated SCHED_DEADLINE runtime to %lf\n", SimulinkInterface::taskNames[taskID], 1e-9 * double(periodNs), GetDeadlineRuntime());
+            }
+            else{
+                GENERIC_TARGET_PRINT_WARNING("Kernel refused SCHED_DEADLINE runtime %lf for task \"%s\" (sampletime=%lf): %s, keeping runtime %lf\n", 1e-9 * double(runtimeNs), SimulinkInterface::taskNames[taskID], 1e-9 * double(periodNs), strerror(errno), GetDeadlineRuntime());
+            }
         }
 
         // Check termination flag
         if(terminate){
             break;
         }
+    }
+    Trace::UnregisterThread();
+}
+
+void PeriodicTask::RunPendingActivations(int64_t notifiedNs){
+    while(!terminate && TakeActivation()){
+        MeasuredStep(notifiedNs);
+    }
+}
+
+int64_t PeriodicTask::MeasuredStep(int64_t notifiedNs){
+    ResourceUsage usage1 = {}, usage2 = {};
+    if(SimulinkInterface::measureResourceUsage){
+        GetThreadResourceUsage(usage1);
+    }
+    jobRunning = true;
+    int64_t cpu1 = GetThreadCPUTime();
+    auto t1 = std::chrono::steady_clock::now();
+    #ifndef _WIN32
+    threadOfStep = pthread_self();
+    #endif
+    timeOfStepStart = std::chrono::duration_cast<std::chrono::nanoseconds>(t1.time_since_epoch()).count();
+    Trace::Event(trace_event::STEP, trace_phase::BEGIN, taskID);
+    SimulinkInterface::Step(taskID);
+    Trace::Event(trace_event::STEP, trace_phase::END, taskID);
+    timeOfStepStart = 0;
+    auto t2 = std::chrono::steady_clock::now();
+    int64_t cpu2 = GetThreadCPUTime();
+    jobRunning = false;
+    if(SimulinkInterface::measureResourceUsage){
+        GetThreadResourceUsage(usage2);
+    }
+    int64_t executionTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+    ResourceUsage usage;
+    usage.numVoluntaryContextSwitches = usage2.numVoluntaryContextSwitches - usage1.numVoluntaryContextSwitches;
+    usage.numInvoluntaryContextSwitches = usage2.numInvoluntaryContextSwitches - usage1.numInvoluntaryContextSwitches;
+    usage.numMinorFaults = usage2.numMinorFaults - usage1.numMinorFaults;
+    usage.numMajorFaults = usage2.numMajorFaults - usage1.numMajorFaults;
+    startLatency.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(t1.time_since_epoch()).count() - notifiedNs);
+    executionTime.Record(executionTimeNs, cpu2 - cpu1, usage, executionTimeBudgetNs);
+    return executionTimeNs;
+}
+
+bool PeriodicTask::SetDeadlineScheduling(uint64_t runtimeNs){
+    // The kernel requires runtime <= deadline <= period and a runtime of at least 1024 nanoseconds
+    const uint64_t periodNs = static_cast<uint64_t>(std::llround(1e9 * SimulinkInterface::baseSampleTime * double(SimulinkInterface::sampleTicks[taskID])));
+    runtimeNs = std::clamp(runtimeNs, uint64_t(1024), periodNs);
+    if(!SetThreadDeadlineScheduling(runtimeNs, periodNs, periodNs)){
+        return false;
+    }
+    deadlineRuntimeNs = runtimeNs;
+    return true;
+}
+
+void PeriodicTask::ExecuteInline(int64_t timeOfTickNs){
+    // Model step calculation
+    int64_t executionTimeNs = MeasuredStep(timeOfTickNs);
 
-        // Model step calculation
-        jobRunning = true;
-        auto t1 = std::chrono::steady_clock::now();
-        SimulinkInterface::Step(taskID);
-        auto t2 = std::chrono::steady_clock::now();
-        jobRunning = false;
-        taskExecutionTime = 1e-9 * double(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+    // Fall back to the thread of this task if the step is too expensive to be executed inline
+    double taskExecutionTime = 1e-9 * double(executionTimeNs);
+    if(!freeRun && (taskExecutionTime > SimulinkInterface::inlineExecutionTimeThreshold)){
+        inlineExecution = false;
+        GENERIC_TARGET_PRINT_WARNING("Execution time %lf of task \"%s\" (sampletime=%lf) exceeds inline threshold %lf: task is executed by its own thread from now on\n", taskExecutionTime, SimulinkInterface::taskNames[taskID], SimulinkInterface::baseSampleTime * double(SimulinkInterface::sampleTicks[taskID]), SimulinkInterface::inlineExecutionTimeThreshold);
     }
 }
 
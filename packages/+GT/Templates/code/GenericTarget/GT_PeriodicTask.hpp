@@ -1,12 +1,36 @@
 #pragma once
 
 
-#include <GenericTarget/GT_Common.hpp>
+#include <GenericTarget/GT_WakeupSignal.hpp>
+#include <GenericTarget/GT_RealTimeThread.hpp>
+#include <GenericTarget/GT_TaskStatistics.hpp>
 
 
 namespace gt {
 
 
+class WorkerPool;
+
+
+/**
+ * @brief This enumeration represents the policy of a periodic task if it is activated while the previous job is still running (task overrun).
+ */
+enum class task_overrun_policy : uint32_t {
+    SKIP = 0,                 ///< At most one activation is kept pending, further activations are skipped (lost).
+    QUEUE = 1,                ///< Up to N activations are kept pending, such that the task catches up after the overrun. Further activations are lost.
+    RESTART_ALIGNED = 2       ///< All pending activations and the overrunning activation are dropped (lost). The task restarts at the next period boundary.
+};
+
+
+/**
+ * @brief This enumeration represents the scheduling policy of the thread of a periodic task.
+ */
+enum class task_scheduling_policy : uint32_t {
+    FIFO = 0,                 ///< SCHED_FIFO with the priority of the task.
+    DEADLINE = 1              ///< [Linux] SCHED_DEADLINE with a period given by the sampletime of the task and a runtime budget derived from measured execution times. Falls back to SCHED_FIFO if the kernel refuses.
+};
+
+
 /**
  * @brief This class represents a task that is notified periodically by the scheduler. It contains a thread
  * that runs the step function of the simulink model with a specified priority.
@@ -18,8 +42,9 @@ class PeriodicTask {
         /**
          * @brief Create a periodic task.
          * @param [in] taskID The task ID for the simulink interface.
+         * @param [in] pool Optional worker pool that executes the steps of this task. If nullptr is given, the task runs its own thread.
          */
-        explicit PeriodicTask(const uint32_t taskID);
+        explicit PeriodicTask(const uint32_t taskID, WorkerPool* pool = nullptr);
 
         /**
          * @brief Delete the periodic task.
@@ -28,9 +53,11 @@ class PeriodicTask {
 
         /**
          * @brief Start or restart the periodic task.
+         * @param [in] freeRun True if the task is driven by a virtual master clock. In this case, no thread is started and all steps are executed
+         * inline, e.g. in the thread that calls @ref Notify, regardless of the inline execution time threshold (default value is: false).
          * @details The number of task overloads will be reset to zero.
          */
-        void Start(void);
+        void Start(bool freeRun = false);
 
         /**
          * @brief Stop the periodic task.
@@ -39,9 +66,20 @@ class PeriodicTask {
 
         /**
          * @brief Notify the thread with the base sampletime.
-         * @details This function returns immediately if the task was not started.
+         * @param [in] timeOfTickNs Steady clock time in nanoseconds of the current tick of the base-rate scheduler. It's the reference for the start latency.
+         * @details This function returns immediately if the task was not started. If inline execution is enabled for this task, the step function
+         * of the model is executed directly in the calling thread instead of notifying the thread of the task. If a worker pool is used,
+         * the task is submitted to the worker pool instead of notifying the thread of the task.
+         */
+        void Notify(int64_t timeOfTickNs);
+
+        /**
+         * @brief Check whether the step function is executed inline, e.g. in the thread that calls @ref Notify.
+         * @return True if inline execution is active, false if the thread of the task executes the step function.
          */
-        void Notify(void);
+        inline bool IsInline(void){
+            return inlineExecution;
+        }
 
         /**
          * @brief Get the number of task overloads.
@@ -51,31 +89,191 @@ class PeriodicTask {
             return numTaskOverloads;
         }
 
+        /**
+         * @brief Get the number of lost activations.
+         * @return Number of activations since @ref Start() that have been dropped according to the overrun policy of the task, e.g. that never resulted in a step of the model.
+         */
+        inline uint64_t GetNumLostActivations(void){
+            return numLostActivations;
+        }
+
         /**
          * @brief Get the task execution time.
          * @returns The latest task execution time in seconds.
          * @details The task execution time is the computation time required by the step function of the model.
          */
         inline double GetTaskExecutionTime(void){
-            return taskExecutionTime;
+            return executionTime.GetLast();
+        }
+
+        /**
+         * @brief Get a consistent snapshot of the execution time statistics since @ref Start().
+         * @return Snapshot of the execution time statistics. The percentiles are the cached values of the latest @ref UpdateExecutionTimePercentiles.
+         */
+        inline TaskStatisticsSnapshot GetExecutionTimeStatistics(void){
+            return executionTime.GetSnapshot();
+        }
+
+        /**
+         * @brief Compute and cache the percentiles of the execution time statistics.
+         * @details This function must not be called by the threads that execute the model.
+         */
+        inline void UpdateExecutionTimePercentiles(void){
+            executionTime.UpdatePercentiles();
+        }
+
+        /**
+         * @brief Get the CPU time of the latest step.
+         * @returns The CPU time of the thread during the latest step in seconds.
+         * @details The difference between the task execution time and the CPU time is the time during which the thread was preempted.
+         */
+        inline double GetTaskCPUTime(void){
+            return executionTime.GetLastCPUTime();
+        }
+
+        /**
+         * @brief Get the histogram of start latencies since @ref Start().
+         * @return Histogram of start latencies.
+         * @details The start latency is the time between the notification of the thread and the start of the step function of the model.
+         */
+        inline const LatencyHistogram& GetStartLatencyHistogram(void){
+            return startLatency;
+        }
+
+        /**
+         * @brief Get the histogram of task execution times since @ref Start().
+         * @return Histogram of task execution times.
+         */
+        inline const LatencyHistogram& GetExecutionTimeHistogram(void){
+            return executionTime.GetHistogram();
         }
 
+        /**
+         * @brief Get the runtime budget of the thread if SCHED_DEADLINE is active.
+         * @return Runtime budget in seconds per period or zero if the thread is not scheduled with SCHED_DEADLINE.
+         */
+        inline double GetDeadlineRuntime(void){
+            return 1e-9 * double(deadlineRuntimeNs);
+        }
+
+        /**
+         * @brief Get the start time of the step that is currently running.
+         * @return Steady clock time in nanoseconds at which the running step has been started or zero if no step is running.
+         */
+        inline int64_t GetTimeOfStepStart(void){
+            return timeOfStepStart;
+        }
+
+        /**
+         * @brief Get the number of steps over budget since @ref Start().
+         * @return Number of steps whose execution time exceeded the execution time budget of the task.
+         */
+        inline uint64_t GetNumOverBudget(void){
+            return executionTime.GetNumOverBudget();
+        }
+
+        /**
+         * @brief Stretch the sampletime of the task by an integer factor, e.g. to shed load under sustained overload.
+         * @param [in] factor The task is notified every factor times its sample ticks (one restores the nominal rate).
+         * @details The new factor takes effect with the next activation of the task.
+         */
+        inline void SetSampleTickStretch(const uint32_t factor){
+            sampleTickStretch = std::max(uint32_t(1), factor);
+        }
+
+        /**
+         * @brief Shift the phase of the task, such that it is notified at all ticks with (tick mod sampleTicks) == offsetTicks.
+         * @param [in] offsetTicks The new sample offset in base-rate ticks.
+         * @param [in] tick The index of the tick at which the task has just been notified (counted from zero).
+         * @details This function must only be called by the thread that calls @ref Notify. The next activation of the task is delayed or advanced once.
+         */
+        void SetSampleOffset(const uint32_t offsetTicks, const uint64_t tick);
+
+        #ifndef _WIN32
+        /**
+         * @brief Get the thread that executes the running step.
+         * @return The thread that executes the step (own thread, worker of the worker pool or base-rate scheduler for inline execution).
+         * @details The returned value is only valid while @ref GetTimeOfStepStart returns the same non-zero value.
+         */
+        inline pthread_t GetThreadOfStep(void){
+            return threadOfStep;
+        }
+        #endif
+
     private:
-        std::thread t;                            ///< Thread object.
-        std::mutex mtx;                           ///< Mutex for thread notification.
-        std::condition_variable cv;               ///< Condition variable for thread notification.
-        bool notified;                            ///< Boolean flag for thread notification.
+        friend class WorkerPool;
+
+        RealTimeThread t;                         ///< Thread object.
+        WorkerPool* const pool;                   ///< Optional worker pool that executes the steps of this task or nullptr if the task runs its own thread.
+        std::atomic<bool> scheduled;              ///< True if the task has been submitted to the worker pool and is queued or running, false otherwise.
+        WakeupSignal wakeupSignal;                ///< Lock-free wakeup signal for thread notification.
         std::atomic<bool> started;                ///< True if periodic task has been started, false otherwise.
         std::atomic<bool> terminate;              ///< True if thread is to be terminated, false otherwise.
         std::atomic<bool> jobRunning;             ///< True if a job is running, e.g. the thread is executing some model code, false otherwise.
         std::atomic<uint64_t> numTaskOverloads;   ///< Total number of task overloads.
+        std::atomic<uint64_t> numLostActivations; ///< Total number of activations that have been dropped due to task overruns.
+        std::atomic<uint32_t> pendingActivations; ///< Number of activations that have been notified but not yet started by the thread.
+        const task_overrun_policy overrunPolicy;  ///< The overrun policy of this task.
+        const uint32_t maxPendingActivations;     ///< Maximum number of pending activations (one for @ref task_overrun_policy::SKIP and @ref task_overrun_policy::RESTART_ALIGNED).
+        std::atomic<bool> inlineExecution;        ///< True if the step function is executed in the thread that calls @ref Notify, false if the thread of this task executes the step function.
+        bool freeRun;                             ///< True if the task is driven by a virtual master clock and always executes its steps inline.
         std::atomic<int> ticks;                   ///< Decrementing tick counter to be used to notify the actual thread with a multiple of the base sampletime.
-        std::atomic<double> taskExecutionTime;    ///< Task-execution time in seconds.
+        std::atomic<uint32_t> sampleTickStretch;  ///< Factor by which the sample ticks of the task are stretched (one for the nominal rate).
+        std::atomic<int64_t> timeOfNotify;        ///< Steady clock time in nanoseconds of the tick at which the thread has been notified.
+        std::atomic<int64_t> timeOfStepStart;     ///< Steady clock time in nanoseconds at which the running step has been started, zero if no step is running.
+        #ifndef _WIN32
+        std::atomic<pthread_t> threadOfStep;      ///< The thread that executes the running step.
+        #endif
+        std::atomic<uint64_t> deadlineRuntimeNs;  ///< Runtime budget in nanoseconds if the thread is scheduled with SCHED_DEADLINE, zero otherwise.
+        LatencyHistogram startLatency;            ///< Histogram of start latencies (notification to start of step function).
+        TaskStatistics executionTime;             ///< Statistics of task execution times.
+        const int64_t executionTimeBudgetNs;      ///< Execution time budget in nanoseconds, steps that take longer are counted as over budget.
 
         /**
          *  @brief Internal thread function.
          */
         void Thread(void);
+
+        /**
+         * @brief Run one model step for each pending activation.
+         * @param [in] notifiedNs Steady clock time in nanoseconds of the tick at which the task has been notified.
+         * @details This function is called by the thread of the task or by a worker of the worker pool.
+         */
+        void RunPendingActivations(int64_t notifiedNs);
+
+        /**
+         * @brief Execute the step function of the model once in the calling thread and record start latency, execution time, CPU time and resource usage.
+         * @param [in] notifiedNs Steady clock time in nanoseconds of the tick at which the task has been notified.
+         * @return The execution time in nanoseconds.
+         * @details The resource usage counters are only obtained if resource usage measurement is enabled.
+         */
+        int64_t MeasuredStep(int64_t notifiedNs);
+
+        /**
+         * @brief Schedule the calling thread with SCHED_DEADLINE.
+         * @param [in] runtimeNs Runtime budget in nanoseconds. The value is limited to the period of the task.
+         * @return True if success, false if the kernel refused the parameters. In this case the scheduling policy of the thread is not changed.
+         * @details The period and the deadline are given by the sampletime of the task.
+         */
+        bool SetDeadlineScheduling(uint64_t runtimeNs);
+
+        /**
+         * @brief Execute the step function of the model in the calling thread.
+         * @param [in] timeOfTickNs Steady clock time in nanoseconds of the current tick of the base-rate scheduler.
+         * @details If the measured execution time exceeds the inline execution time threshold, inline execution is disabled and all further steps are
+         * executed by the thread of this task.
+         */
+        void ExecuteInline(int64_t timeOfTickNs);
+
+        /**
+         * @brief Take one pending activation.
+         * @return True if a pending activation has been taken, false if there is no pending activation.
+         */
+        inline bool TakeActivation(void){
+            uint32_t n = pendingActivations.load();
+            while(n && !pendingActivations.compare_exchange_weak(n, n - 1));
+            return (n > 0);
+        }
 };
 
 
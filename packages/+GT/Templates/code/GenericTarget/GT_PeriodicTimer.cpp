@@ -7,19 +7,46 @@ PeriodicTimer::PeriodicTimer(){
     hTimer = NULL;
     #else
     fdTimer = -1;
+    deadlineTimerActive = false;
+    spinNs = 0;
+    armedExpiryNs = 0;
+    armedIntervalNs = 0;
+    pendingDriftNs = 0;
+    ticksSinceRearm = 0;
     #endif
     numCPUOverloads = 0;
     numLostTicks = 0;
+    periodNs = 0;
+    nextExpiryNs = 0;
+    currentExpiryNs = 0;
+    periodAdjustmentNs = 0;
+    phaseErrorNs = 0;
+    alignment = periodic_timer_alignment::NONE;
+    anchorNs = 0;
     timeOfStart = std::chrono::steady_clock::now();
 }
 
-bool PeriodicTimer::Start(double sampletime){
+bool PeriodicTimer::Start(double sampletime, periodic_timer_mode mode, double spinTime, periodic_timer_alignment alignment, double phaseOffset){
     const double timeToWaitBeforeStart = 0.1;
     if(!std::chrono::steady_clock::is_steady){
         GENERIC_TARGET_PRINT_WARNING("Clock is not steady!\n");
     }
     Stop();
+    wakeupLatency.Reset();
+    phaseError.Reset();
+    phaseErrorNs = 0;
+    periodAdjustmentNs = 0;
+    this->alignment = alignment;
     #ifdef _WIN32
+    (void) spinTime;
+    (void) phaseOffset;
+    if(periodic_timer_alignment::NONE != alignment){
+        GENERIC_TARGET_PRINT_WARNING("Timer alignment is not supported on windows, the phase of the timer is arbitrary!\n");
+        this->alignment = periodic_timer_alignment::NONE;
+    }
+    if(periodic_timer_mode::ABSOLUTE_DEADLINE == mode){
+        GENERIC_TARGET_PRINT_WARNING("Absolute deadline timer is not supported on windows, a waitable timer is used instead!\n");
+    }
     if(sampletime < 0.001){
         GENERIC_TARGET_PRINT_ERROR("A sample rate less than 1 millisecond can not be set on windows!\n");
         return false;
@@ -32,12 +59,30 @@ bool PeriodicTimer::Start(double sampletime){
     LARGE_INTEGER lpDueTime;
     lpDueTime.QuadPart = (LONGLONG)(timeToWaitBeforeStart * 1e7 * -1); // in 100 ns, negative for relative time (positive would be absolute time using UTC)
     LONG lPeriod = (LONG)(sampletime * 1e3);
+    periodNs = int64_t(lPeriod) * 1000000;
+    nextExpiryNs = GetMonotonicTimeNs() + int64_t(timeToWaitBeforeStart * 1e9);
     if(!SetWaitableTimer(hTimer, &lpDueTime, lPeriod, NULL, NULL, false)){ // No completetion routine, no args for completetion routine, no resume
         GENERIC_TARGET_PRINT_ERROR("Could not set waitable timer!\n");
         CloseHandle(hTimer);
         hTimer = NULL;
     }
     #else
+    const int64_t phaseOffsetNs = static_cast<int64_t>(std::llround(phaseOffset * 1e9));
+    if(periodic_timer_mode::ABSOLUTE_DEADLINE == mode){
+        // No kernel timer object is required, deadlines are computed from the period
+        periodNs = static_cast<int64_t>(std::llround(sampletime * 1e9));
+        if(periodNs <= 0){
+            GENERIC_TARGET_PRINT_ERROR("Invalid sampletime %lf for absolute deadline timer!\n", sampletime);
+            return false;
+        }
+        spinNs = std::clamp(static_cast<int64_t>(std::llround(spinTime * 1e9)), int64_t(0), periodNs);
+        nextExpiryNs = GetAlignedExpiryNs(GetMonotonicTimeNs() + int64_t(timeToWaitBeforeStart * 1e9), phaseOffsetNs);
+        deadlineTimerActive = true;
+        numCPUOverloads = 0;
+        numLostTicks = 0;
+        timeOfStart = std::chrono::steady_clock::now();
+        return true;
+    }
     if((fdTimer = timerfd_create(CLOCK_MONOTONIC, 0)) < 0){ // 0: no flags
         GENERIC_TARGET_PRINT_ERROR("Could not create timer!\n");
         return false;
@@ -45,14 +90,20 @@ bool PeriodicTimer::Start(double sampletime){
     struct itimerspec its;
     its.it_interval.tv_sec = (time_t)sampletime;
     its.it_interval.tv_nsec = (sampletime - (time_t)sampletime) * 1000000000;
-    its.it_value.tv_sec = (time_t)timeToWaitBeforeStart;
-    its.it_value.tv_nsec = (timeToWaitBeforeStart - (time_t)timeToWaitBeforeStart) * 1000000000;
-    if(timerfd_settime(fdTimer, 0, &its, nullptr) < 0){ // 0: no flags
+    periodNs = int64_t(its.it_interval.tv_sec) * 1000000000 + int64_t(its.it_interval.tv_nsec);
+    nextExpiryNs = GetAlignedExpiryNs(GetMonotonicTimeNs() + int64_t(timeToWaitBeforeStart * 1e9), phaseOffsetNs);
+    its.it_value.tv_sec = (time_t)(nextExpiryNs / 1000000000);
+    its.it_value.tv_nsec = (long)(nextExpiryNs % 1000000000);
+    if(timerfd_settime(fdTimer, TFD_TIMER_ABSTIME, &its, nullptr) < 0){ // absolute time of first expiry, such that the ideal expiry times are known
         GENERIC_TARGET_PRINT_ERROR("Could not set time for timer!\n");
         close(fdTimer);
         fdTimer = -1;
         return false;
     }
+    armedExpiryNs = nextExpiryNs;
+    armedIntervalNs = periodNs;
+    pendingDriftNs = 0;
+    ticksSinceRearm = 0;
     #endif
     numCPUOverloads = 0;
     numLostTicks = 0;
@@ -67,6 +118,7 @@ void PeriodicTimer::Stop(void){
         hTimer = NULL;
     }
     #else
+    deadlineTimerActive = false;
     if(fdTimer >= 0){
         close(fdTimer);
         fdTimer = -1;
@@ -77,11 +129,29 @@ void PeriodicTimer::Stop(void){
 bool PeriodicTimer::WaitForTick(bool resetTimeOfStart){
     #ifdef _WIN32
     bool result = (WaitForSingleObject(hTimer, INFINITE) == WAIT_OBJECT_0);
+    if(result){
+        int64_t latency = GetMonotonicTimeNs() - nextExpiryNs;
+        if(periodNs && (latency >= periodNs)){
+            int64_t exp = 1 + latency / periodNs;
+            nextExpiryNs += (exp - 1) * periodNs;
+            latency -= (exp - 1) * periodNs;
+        }
+        wakeupLatency.Record(latency);
+        currentExpiryNs = nextExpiryNs;
+        nextExpiryNs += periodNs;
+    }
     if(resetTimeOfStart){
         timeOfStart = std::chrono::steady_clock::now();
     }
     return result;
     #else
+    if(deadlineTimerActive){
+        bool result = WaitForDeadline();
+        if(resetTimeOfStart){
+            timeOfStart = std::chrono::steady_clock::now();
+        }
+        return result;
+    }
     int s = -1;
     uint64_t exp = 0;
     for(;;){
@@ -89,6 +159,18 @@ bool PeriodicTimer::WaitForTick(bool resetTimeOfStart){
         if((s == -1) && (errno == EINTR)){
             continue;
         }
+        if((s != -1) && exp){
+            // The latest expiry of the armed timer is the one that woke up this thread
+            currentExpiryNs = armedExpiryNs + int64_t(exp - 1) * armedIntervalNs;
+            wakeupLatency.Record(GetMonotonicTimeNs() - currentExpiryNs);
+            armedExpiryNs = currentExpiryNs + armedIntervalNs;
+
+            // Desired next expiry: the armed one shifted by the accumulated period adjustment and the phase correction
+            pendingDriftNs += int64_t(exp) * (periodNs + periodAdjustmentNs - armedIntervalNs);
+            nextExpiryNs = armedExpiryNs + pendingDriftNs;
+            CorrectPhase();
+            RearmTimer();
+        }
         if(exp > 1){
             ++numCPUOverloads;
             numLostTicks += (exp - 1);
@@ -102,8 +184,132 @@ bool PeriodicTimer::WaitForTick(bool resetTimeOfStart){
     #endif
 }
 
+double PeriodicTimer::GetTimeOfTick(void){
+    // The steady clock is the monotonic clock that drives the timer
+    int64_t timeOfStartNs = std::chrono::duration_cast<std::chrono::nanoseconds>(timeOfStart.time_since_epoch()).count();
+    return 1e-9 * double(currentExpiryNs - timeOfStartNs);
+}
+
+void PeriodicTimer::SetPeriodAdjustment(double adjustment){
+    #ifdef _WIN32
+    (void) adjustment;
+    #else
+    const int64_t maxAdjustmentNs = static_cast<int64_t>(GENERIC_TARGET_TIMER_PHASE_MAX_CORRECTION * double(periodNs));
+    periodAdjustmentNs = std::clamp(static_cast<int64_t>(std::llround(adjustment * 1e9)), -maxAdjustmentNs, maxAdjustmentNs);
+    #endif
+}
+
 double PeriodicTimer::GetTimeToStart(void){
     auto timeNow = std::chrono::steady_clock::now();
     return 1e-9 * double(std::chrono::duration_cast<std::chrono::nanoseconds>(timeNow - timeOfStart).count());
 }
 
+#ifndef _WIN32
+bool PeriodicTimer::WaitForDeadline(void){
+    // Sleep until the deadline (minus the spin time), a signal does not change the absolute wakeup time
+    const int64_t deadlineNs = nextExpiryNs;
+    const int64_t wakeupNs = deadlineNs - spinNs;
+    struct timespec ts;
+    ts.tv_sec = (time_t)(wakeupNs / 1000000000);
+    ts.tv_nsec = (long)(wakeupNs % 1000000000);
+    while(EINTR == clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr));
+
+    // Busy-spin for the remaining time
+    int64_t timeNow = GetMonotonicTimeNs();
+    while(timeNow < deadlineNs){
+        timeNow = GetMonotonicTimeNs();
+    }
+    if(!deadlineTimerActive){
+        return false;
+    }
+
+    // Count expired deadlines, the latest expired deadline is the one that is handled now
+    uint64_t exp = 1 + uint64_t((timeNow - deadlineNs) / periodNs);
+    nextExpiryNs = deadlineNs + int64_t(exp - 1) * periodNs;
+    wakeupLatency.Record(timeNow - nextExpiryNs);
+    currentExpiryNs = nextExpiryNs;
+    nextExpiryNs += periodNs + periodAdjustmentNs;
+    CorrectPhase();
+    if(exp > 1){
+        ++numCPUOverloads;
+        numLostTicks += (exp - 1);
+    }
+    return true;
+}
+
+int64_t PeriodicTimer::GetReferenceTimeNs(void){
+    struct timespec ts;
+    #ifdef CLOCK_TAI
+    clock_gettime((periodic_timer_alignment::TAI == alignment) ? CLOCK_TAI : CLOCK_REALTIME, &ts);
+    #else
+    clock_gettime(CLOCK_REALTIME, &ts);
+    #endif
+    return int64_t(ts.tv_sec) * 1000000000 + int64_t(ts.tv_nsec);
+}
+
+int64_t PeriodicTimer::GetAlignedExpiryNs(int64_t earliestNs, int64_t phaseOffsetNs){
+    if(periodic_timer_alignment::NONE == alignment){
+        return earliestNs;
+    }
+
+    // Next full second of the reference clock plus phase offset that is not earlier than the earliest expiry
+    const int64_t second = 1000000000;
+    int64_t offsetNs = GetReferenceTimeNs() - GetMonotonicTimeNs();
+    int64_t earliestReferenceNs = earliestNs + offsetNs - phaseOffsetNs;
+    anchorNs = ((earliestReferenceNs + second - 1) / second) * second + phaseOffsetNs;
+    return anchorNs - offsetNs;
+}
+
+void PeriodicTimer::CorrectPhase(void){
+    if(periodic_timer_alignment::NONE == alignment){
+        return;
+    }
+
+    // Phase error of the current tick (ideal expiry) with respect to the grid anchorNs + k * periodNs of the reference clock, wrapped to [-period/2, period/2)
+    int64_t offsetNs = GetReferenceTimeNs() - GetMonotonicTimeNs();
+    int64_t errorNs = ((currentExpiryNs + offsetNs - anchorNs) % periodNs + periodNs) % periodNs;
+    if(errorNs >= (periodNs / 2)){
+        errorNs -= periodNs;
+    }
+    phaseErrorNs = errorNs;
+    phaseError.Record(std::abs(errorNs));
+
+    // Shift the next expiry, the correction per tick is limited to avoid large jumps of the period
+    if(std::abs(errorNs) < GENERIC_TARGET_TIMER_PHASE_DEADBAND_NS){
+        return;
+    }
+    const int64_t maxCorrectionNs = std::max(int64_t(1), static_cast<int64_t>(GENERIC_TARGET_TIMER_PHASE_MAX_CORRECTION * double(periodNs)));
+    nextExpiryNs -= std::clamp(errorNs, -maxCorrectionNs, maxCorrectionNs);
+}
+
+void PeriodicTimer::RearmTimer(void){
+    if(fdTimer < 0){
+        return;
+    }
+
+    // Small corrections are not worth a system call on every tick: keep the armed expiry until the correction is large enough or pending for long enough
+    const int64_t intervalNs = periodNs + periodAdjustmentNs;
+    const int64_t deviationNs = nextExpiryNs - armedExpiryNs;
+    ++ticksSinceRearm;
+    if(!deviationNs && (intervalNs == armedIntervalNs)){
+        return;
+    }
+    if((std::abs(deviationNs) < GENERIC_TARGET_TIMER_REARM_THRESHOLD_NS) && (ticksSinceRearm < GENERIC_TARGET_TIMER_REARM_INTERVAL_TICKS)){
+        nextExpiryNs = armedExpiryNs;
+        return;
+    }
+    armedExpiryNs = nextExpiryNs;
+    armedIntervalNs = intervalNs;
+    pendingDriftNs = 0;
+    ticksSinceRearm = 0;
+    struct itimerspec its;
+    its.it_interval.tv_sec = (time_t)(intervalNs / 1000000000);
+    its.it_interval.tv_nsec = (long)(intervalNs % 1000000000);
+    its.it_value.tv_sec = (time_t)(nextExpiryNs / 1000000000);
+    its.it_value.tv_nsec = (long)(nextExpiryNs % 1000000000);
+    if(timerfd_settime(fdTimer, TFD_TIMER_ABSTIME, &its, nullptr) < 0){
+        GENERIC_TARGET_PRINT_WARNING("Could not re-arm the timer!\n");
+    }
+}
+#endif
+
@@ -1,12 +1,31 @@
 #pragma once
 
 
-#include <GenericTarget/GT_Common.hpp>
+#include <GenericTarget/GT_LatencyHistogram.hpp>
 
 
 namespace gt {
 
 
+/**
+ * @brief This enumeration represents the backend of the periodic timer.
+ */
+enum class periodic_timer_mode : uint32_t {
+    TIMERFD = 0,                ///< Periodic timer file descriptor (linux) or waitable timer (windows). Each tick is received by a blocking read.
+    ABSOLUTE_DEADLINE = 1       ///< [Linux] Sleep until precomputed absolute deadlines using clock_nanosleep, optionally followed by a busy-spin for the last part of the period.
+};
+
+
+/**
+ * @brief This enumeration represents the reference clock to which the ticks of the periodic timer are phase-aligned.
+ */
+enum class periodic_timer_alignment : uint32_t {
+    NONE = 0,                   ///< The first tick occurs a fixed time after the start, the phase is arbitrary.
+    REALTIME = 1,               ///< [Linux] The first tick occurs at a full second of CLOCK_REALTIME (UTC) plus a phase offset and the ticks are kept phase-locked to that clock.
+    TAI = 2                     ///< [Linux] The first tick occurs at a full second of CLOCK_TAI plus a phase offset and the ticks are kept phase-locked to that clock.
+};
+
+
 /**
  * @brief This class represents a periodic timer that waits for timer interrupts. The periodic time is set when calling the @ref Start
  * member function. On windows, the lowest possible value is 1 millisecond.
@@ -21,10 +40,18 @@ class PeriodicTimer {
         /**
          * @brief Start the periodic timer.
          * @param [in] sampletime The sampletime in seconds.
+         * @param [in] mode The timer backend to be used (default value is: @ref periodic_timer_mode::TIMERFD).
+         * @param [in] spinTime Time in seconds before each deadline during which the thread busy-spins instead of sleeping (default value is: 0). This value is only used for @ref periodic_timer_mode::ABSOLUTE_DEADLINE and is limited to the sampletime.
+         * @param [in] alignment The reference clock to which the ticks are phase-aligned (default value is: @ref periodic_timer_alignment::NONE).
+         * @param [in] phaseOffset Offset in seconds of the first tick to the full second of the reference clock (default value is: 0). This value is only used if an alignment is set.
          * @return True if success, false otherwise.
-         * @details On Windows, the sampletime must not be less than 0.001!
+         * @details On Windows, the sampletime must not be less than 0.001 and only @ref periodic_timer_mode::TIMERFD without alignment is supported!
+         * The timer itself always runs on the monotonic clock. If an alignment is set, the phase error of each tick with respect to the reference clock is measured
+         * and corrected by shifting the next expiry by at most @ref GENERIC_TARGET_TIMER_PHASE_MAX_CORRECTION of the period. For @ref periodic_timer_mode::TIMERFD,
+         * corrections are collected and the timer file descriptor is only re-armed if the pending shift of the next expiry reaches @ref GENERIC_TARGET_TIMER_REARM_THRESHOLD_NS
+         * or @ref GENERIC_TARGET_TIMER_REARM_INTERVAL_TICKS ticks have passed since the latest re-arm, see @ref RearmTimer.
          */
-        bool Start(double sampletime);
+        bool Start(double sampletime, periodic_timer_mode mode = periodic_timer_mode::TIMERFD, double spinTime = 0.0, periodic_timer_alignment alignment = periodic_timer_alignment::NONE, double phaseOffset = 0.0);
 
         /**
          * @brief Stop the periodic timer.
@@ -57,14 +84,123 @@ class PeriodicTimer {
          */
         inline uint64_t GetNumLostTicks(void){ return numLostTicks; }
 
+        /**
+         * @brief Get the histogram of wakeup latencies since the start of this timer.
+         * @return Histogram of wakeup latencies.
+         * @details The wakeup latency is the time between the ideal expiry of the timer and the return from the blocking wait in @ref WaitForTick.
+         */
+        inline const LatencyHistogram& GetWakeupLatencyHistogram(void){ return wakeupLatency; }
+
+        /**
+         * @brief Get the phase error of the latest tick with respect to the aligned reference clock.
+         * @return Phase error in seconds (positive if the tick is late) or zero if no alignment is set.
+         * @details The phase error is measured before the correction is applied to the next expiry.
+         */
+        inline double GetPhaseError(void){ return 1e-9 * double(phaseErrorNs.load()); }
+
+        /**
+         * @brief Get the histogram of absolute phase errors since the start of this timer.
+         * @return Histogram of absolute phase errors (only recorded if an alignment is set).
+         */
+        inline const LatencyHistogram& GetPhaseErrorHistogram(void){ return phaseError; }
+
+        /**
+         * @brief Get the ideal time of the latest tick.
+         * @return Ideal expiry of the latest tick in seconds, relative to the time of start (same time base as @ref GetTimeToStart).
+         */
+        double GetTimeOfTick(void);
+
+        /**
+         * @brief Adjust the period of the timer, e.g. to keep the ticks phase-locked to another clock.
+         * @param [in] adjustment Time in seconds to be added to the nominal period. The value is limited to @ref GENERIC_TARGET_TIMER_PHASE_MAX_CORRECTION of the nominal period.
+         * @details The adjusted period is used from the tick after the next tick on. This function must be called by the thread that waits for ticks. On windows, the period can not be adjusted.
+         * For @ref periodic_timer_mode::TIMERFD, this function does not enter the kernel. The difference to the period of the timer file descriptor is accumulated and applied by
+         * the next re-arm of the timer, see @ref RearmTimer.
+         */
+        void SetPeriodAdjustment(double adjustment);
+
+        /**
+         * @brief Get the current adjustment of the period.
+         * @return Time in seconds that is added to the nominal period.
+         */
+        inline double GetPeriodAdjustment(void){ return 1e-9 * double(periodAdjustmentNs.load()); }
+
     private:
         std::chrono::time_point<std::chrono::steady_clock> timeOfStart;   ///< Timepoint of start. This timepoint is set during construction, @ref Create and during @ref WaitForSignal, if resetTimeOfStart is set to true.
         std::atomic<uint64_t> numCPUOverloads;                            ///< Number of CPU overloads that have been occurred since @ref Create. If the timer is expired by more than one tick, this value is incremented by one.
         std::atomic<uint64_t> numLostTicks;                               ///< Number of lost ticks from the timer since @ref Create. If the timer is expired by more than one tick, this value is incremented by the number of additional expired ticks (lost ticks).
+        int64_t periodNs;                                                 ///< The period of the timer in nanoseconds.
+        int64_t nextExpiryNs;                                             ///< Ideal time of the next timer expiry in nanoseconds (monotonic clock).
+        std::atomic<int64_t> currentExpiryNs;                             ///< Ideal time of the latest timer expiry in nanoseconds (monotonic clock).
+        std::atomic<int64_t> periodAdjustmentNs;                          ///< Time in nanoseconds that is added to the nominal period.
+        LatencyHistogram wakeupLatency;                                   ///< Histogram of wakeup latencies (actual wakeup vs. ideal expiry).
+        LatencyHistogram phaseError;                                      ///< Histogram of absolute phase errors with respect to the aligned reference clock.
+        std::atomic<int64_t> phaseErrorNs;                                ///< Phase error of the latest tick in nanoseconds.
+        periodic_timer_alignment alignment;                               ///< The reference clock to which the ticks are phase-aligned.
+        int64_t anchorNs;                                                 ///< Time of the first tick in nanoseconds (reference clock), all ticks are aligned to anchorNs + k * periodNs.
         #ifdef _WIN32
         HANDLE hTimer;                                                    ///< [Windows] Handle of internal timer object.
         #else
         int fdTimer;                                                      ///< [Linux] File descriptor of internal timer object.
+        std::atomic<bool> deadlineTimerActive;                            ///< [Linux] True if the timer has been started with @ref periodic_timer_mode::ABSOLUTE_DEADLINE and has not been stopped.
+        int64_t spinNs;                                                   ///< [Linux] Time in nanoseconds before each deadline during which the thread busy-spins.
+        int64_t armedExpiryNs;                                            ///< [Linux] Next expiry in nanoseconds (monotonic clock) at which the timer file descriptor actually expires.
+        int64_t armedIntervalNs;                                          ///< [Linux] Interval in nanoseconds with which the timer file descriptor has been armed.
+        int64_t pendingDriftNs;                                           ///< [Linux] Accumulated difference between the adjusted period and @ref armedIntervalNs that has not yet been applied to the timer file descriptor.
+        uint32_t ticksSinceRearm;                                         ///< [Linux] Number of ticks since the timer file descriptor has been armed.
+        #endif
+
+        /**
+         * @brief Get the current time of the monotonic clock that drives the timer.
+         * @return Monotonic time in nanoseconds.
+         */
+        static inline int64_t GetMonotonicTimeNs(void){
+            #ifdef _WIN32
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            #else
+            struct timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            return int64_t(ts.tv_sec) * 1000000000 + int64_t(ts.tv_nsec);
+            #endif
+        }
+
+        #ifndef _WIN32
+        /**
+         * @brief [Linux] Get the current time of the reference clock to which the ticks are aligned.
+         * @return Time of CLOCK_REALTIME or CLOCK_TAI in nanoseconds, depending on the @ref alignment.
+         */
+        int64_t GetReferenceTimeNs(void);
+
+        /**
+         * @brief [Linux] Compute the ideal time of the first expiry on the monotonic clock, such that it coincides with the next full second of the reference clock plus the phase offset.
+         * @param [in] earliestNs Earliest possible time of the first expiry (monotonic clock) in nanoseconds.
+         * @param [in] phaseOffsetNs Offset to the full second in nanoseconds.
+         * @return Time of the first expiry (monotonic clock) in nanoseconds.
+         */
+        int64_t GetAlignedExpiryNs(int64_t earliestNs, int64_t phaseOffsetNs);
+
+        /**
+         * @brief [Linux] Measure the phase error of the current tick with respect to the reference clock and shift the next expiry to correct it.
+         * @details This function must be called after @ref nextExpiryNs has been advanced to the next tick.
+         */
+        void CorrectPhase(void);
+
+        /**
+         * @brief [Linux] Re-arm the timer file descriptor with the next expiry and the adjusted period if the correction is large enough or has been pending for long enough.
+         * @details This function has no effect if the timer does not use a timer file descriptor. The timer file descriptor is re-armed if the next expiry deviates from
+         * @ref armedExpiryNs by at least @ref GENERIC_TARGET_TIMER_REARM_THRESHOLD_NS or if the next expiry or the interval differ from the armed ones and
+         * @ref GENERIC_TARGET_TIMER_REARM_INTERVAL_TICKS ticks have passed since the latest re-arm. Otherwise, the next expiry is reset to @ref armedExpiryNs: a phase
+         * correction below the threshold is discarded (it is measured again at the next tick) and a period adjustment remains in @ref pendingDriftNs.
+         * Re-arming resets the expiration counter of the timer file descriptor. Ticks that expire between the read in @ref WaitForTick and the re-arm are not counted as lost ticks.
+         */
+        void RearmTimer(void);
+
+        /**
+         * @brief [Linux] Wait for the next absolute deadline (@ref periodic_timer_mode::ABSOLUTE_DEADLINE).
+         * @return True if the deadline has been reached, false if the timer has been stopped.
+         * @details The CPU overload and lost tick counters are updated in the same way as for the timer file descriptor.
+         */
+        bool WaitForDeadline(void);
         #endif
 };
 
@@ -0,0 +1,85 @@
+#include <GenericTarget/GT_RealTimeMemory.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
+using namespace gt;
+
+
+bool RealTimeMemory::Lock(size_t heapReserveSize){
+    #ifdef _WIN32
+    (void) heapReserveSize;
+    GENERIC_TARGET_PRINT_WARNING("Memory locking is not supported on windows\n");
+    return false;
+    #else
+    bool success = true;
+
+    // Never give memory back to the system and serve all allocations from the heap of the main arena
+    if(!mallopt(M_TRIM_THRESHOLD, -1)){
+        GENERIC_TARGET_PRINT_WARNING("Could not disable malloc trimming\n");
+        success = false;
+    }
+    if(!mallopt(M_MMAP_MAX, 0)){
+        GENERIC_TARGET_PRINT_WARNING("Could not disable mmap allocations\n");
+        success = false;
+    }
+    if(!mallopt(M_ARENA_MAX, 1)){
+        GENERIC_TARGET_PRINT_WARNING("Could not limit the number of malloc arenas\n");
+        success = false;
+    }
+
+    // Lock all current and future pages into RAM
+    if(0 != mlockall(MCL_CURRENT | MCL_FUTURE)){
+        GENERIC_TARGET_PRINT_WARNING("Could not lock memory: %s\n", strerror(errno));
+        success = false;
+    }
+
+    // Touch each page of the reserved heap once, the memory is not returned to the system when it's freed
+    if(heapReserveSize){
+        const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        volatile uint8_t* heap = static_cast<volatile uint8_t*>(malloc(heapReserveSize));
+        if(heap){
+            for(size_t i = 0; i < heapReserveSize; i += pageSize){
+                heap[i] = 0;
+            }
+            free((void*)heap);
+        }
+        else{
+            GENERIC_TARGET_PRINT_WARNING("Could not reserve %lu bytes of heap memory\n", heapReserveSize);
+            success = false;
+        }
+    }
+
+    // Prefault the stack of the calling thread
+    PrefaultStack();
+    GENERIC_TARGET_PRINT("Memory %s (heapReserveSize=%lu, stackPrefaultSize=%u, RSS=%.3lf MiB)\n", success ? "locked" : "locking incomplete", heapReserveSize, SimulinkInterface::stackPrefaultSize, double(GetResidentSetSize()) / 1048576.0);
+    return success;
+    #endif
+}
+
+void RealTimeMemory::PrefaultStack(void){
+    #ifndef _WIN32
+    const size_t size = SimulinkInterface::stackPrefaultSize;
+    if(!SimulinkInterface::lockMemory || !size){
+        return;
+    }
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    volatile uint8_t* stack = static_cast<volatile uint8_t*>(alloca(size));
+    for(size_t i = 0; i < size; i += pageSize){
+        stack[i] = 0;
+    }
+    #endif
+}
+
+size_t RealTimeMemory::GetResidentSetSize(void){
+    #ifdef _WIN32
+    return 0;
+    #else
+    unsigned long numPagesTotal = 0, numPagesResident = 0;
+    FILE* file = fopen("/proc/self/statm", "r");
+    if(!file){
+        return 0;
+    }
+    int n = fscanf(file, "%lu %lu", &numPagesTotal, &numPagesResident);
+    fclose(file);
+    return (2 == n) ? (static_cast<size_t>(numPagesResident) * static_cast<size_t>(sysconf(_SC_PAGESIZE))) : 0;
+    #endif
+}
+
@@ -0,0 +1,41 @@
+#pragma once
+
+
+#include <GenericTarget/GT_Common.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief This class hardens the memory of the process for realtime operation. All memory is locked into RAM, the heap is pre-reserved and
+ * the stacks of realtime threads are prefaulted, such that no page faults occur in the first seconds after the start of the model.
+ */
+class RealTimeMemory {
+    public:
+        /**
+         * @brief Lock the memory of the process.
+         * @param [in] heapReserveSize Number of bytes to be reserved and prefaulted on the heap, e.g. for data recorder and UDP buffers.
+         * @return True if success, false if at least one step failed. All failures are printed as warnings.
+         * @details The following steps are performed: malloc trimming and mmap allocations are disabled, all current and future pages
+         * are locked via mlockall, the heap is pre-reserved and the stack of the calling thread is prefaulted. The resulting resident set size is printed.
+         * This function is not supported on windows.
+         */
+        static bool Lock(size_t heapReserveSize);
+
+        /**
+         * @brief Prefault the stack of the calling thread.
+         * @details This function is called for the main thread when memory is locked. Threads started by @ref RealTimeThread are prefaulted before they run. It has no effect if memory locking is disabled.
+         */
+        static void PrefaultStack(void);
+
+        /**
+         * @brief Get the resident set size of the process.
+         * @return Resident set size in bytes or zero if it cannot be determined.
+         */
+        static size_t GetResidentSetSize(void);
+};
+
+
+} /* namespace: gt */
+
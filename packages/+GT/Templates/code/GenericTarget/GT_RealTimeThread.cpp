@@ -0,0 +1,171 @@
+#include <GenericTarget/GT_RealTimeThread.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
+using namespace gt;
+
+
+RealTimeThread::RealTimeThread(){
+    started = false;
+    #ifndef _WIN32
+    thread = pthread_t();
+    stack = nullptr;
+    stackSize = 0;
+    #endif
+}
+
+RealTimeThread::~RealTimeThread(){
+    Join();
+}
+
+bool RealTimeThread::Start(std::function<void(void)> function, std::string name, int priority, uint64_t cpuMask){
+    // Make sure that the thread is joined
+    Join();
+    this->function = function;
+    this->name = name.substr(0, 15);
+
+    #ifdef _WIN32
+    thread = std::thread(this->function);
+    if(priority > 0){
+        struct sched_param param;
+        param.sched_priority = priority;
+        if(0 != pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &param)){
+            GENERIC_TARGET_PRINT_WARNING("Could not set thread priority %d for thread \"%s\"\n", priority, this->name.c_str());
+        }
+    }
+    if(cpuMask){
+        GENERIC_TARGET_PRINT_WARNING("Could not set CPU affinity 0x%llX for thread \"%s\": not supported on windows\n", (unsigned long long)cpuMask, this->name.c_str());
+    }
+    return (started = true);
+    #else
+    if(!AllocateStack()){
+        GENERIC_TARGET_PRINT_WARNING("Could not allocate the stack for thread \"%s\": %s\n", this->name.c_str(), strerror(errno));
+    }
+
+    // Create the thread with all attributes, drop attributes that are refused by the operating system
+    int result = Create(priority, cpuMask);
+    const int firstResult = result;
+    if(result && cpuMask && !(result = Create(priority, 0))){
+        GENERIC_TARGET_PRINT_WARNING("Could not set CPU affinity 0x%llX for thread \"%s\": %s\n", (unsigned long long)cpuMask, this->name.c_str(), strerror(firstResult));
+    }
+    if(result && (priority > 0) && !(result = Create(0, cpuMask))){
+        GENERIC_TARGET_PRINT_WARNING("Could not set thread priority %d for thread \"%s\": %s\n", priority, this->name.c_str(), strerror(firstResult));
+    }
+    if(result && (priority > 0) && cpuMask && !(result = Create(0, 0))){
+        GENERIC_TARGET_PRINT_WARNING("Could not set thread priority %d and CPU affinity 0x%llX for thread \"%s\": %s\n", priority, (unsigned long long)cpuMask, this->name.c_str(), strerror(firstResult));
+    }
+    if(result){
+        GENERIC_TARGET_PRINT_ERROR("Could not create thread \"%s\": %s\n", this->name.c_str(), strerror(result));
+        Join();
+        return false;
+    }
+    return (started = true);
+    #endif
+}
+
+void RealTimeThread::Join(void){
+    if(started){
+        #ifdef _WIN32
+        if(thread.joinable()){
+            thread.join();
+        }
+        #else
+        (void) pthread_join(thread, nullptr);
+        #endif
+        started = false;
+    }
+    #ifndef _WIN32
+    if(stack){
+        (void) munmap(stack, stackSize);
+        stack = nullptr;
+        stackSize = 0;
+    }
+    #endif
+}
+
+#ifndef _WIN32
+bool RealTimeThread::AllocateStack(void){
+    // Use the default stack size of the C library, but at least the size to be prefaulted
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t size = 0;
+    pthread_attr_t attr;
+    if(0 == pthread_attr_init(&attr)){
+        (void) pthread_attr_getstacksize(&attr, &size);
+        (void) pthread_attr_destroy(&attr);
+    }
+    size = std::max(size, size_t(SimulinkInterface::stackPrefaultSize) + 16 * pageSize);
+    size = ((size + pageSize - 1) / pageSize) * pageSize;
+
+    // The lowest page is a guard page that catches stack overflows
+    void* memory = mmap(nullptr, size + pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+    if(MAP_FAILED == memory){
+        return false;
+    }
+    (void) mprotect(memory, pageSize, PROT_NONE);
+    stack = memory;
+    stackSize = size + pageSize;
+
+    // Prefault the top of the stack (the stack grows towards lower addresses)
+    if(SimulinkInterface::lockMemory){
+        volatile uint8_t* top = static_cast<volatile uint8_t*>(memory) + stackSize;
+        const size_t prefaultSize = std::min(size_t(SimulinkInterface::stackPrefaultSize), size);
+        for(size_t i = pageSize; i <= prefaultSize; i += pageSize){
+            *(top - i) = 0;
+        }
+    }
+    return true;
+}
+
+int RealTimeThread::Create(int priority, uint64_t cpuMask){
+    pthread_attr_t attr;
+    int result = pthread_attr_init(&attr);
+    if(result){
+        return result;
+    }
+
+    // Pre-allocated stack
+    if(stack){
+        const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        result = pthread_attr_setstack(&attr, static_cast<uint8_t*>(stack) + pageSize, stackSize - pageSize);
+    }
+
+    // Explicit scheduling, such that the thread never runs with the scheduling of the creating thread
+    struct sched_param param;
+    std::memset(&param, 0, sizeof(param));
+    param.sched_priority = (priority > 0) ? priority : 0;
+    if(!result){
+        result = pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    }
+    if(!result){
+        result = pthread_attr_setschedpolicy(&attr, (priority > 0) ? SCHED_FIFO : SCHED_OTHER);
+    }
+    if(!result){
+        result = pthread_attr_setschedparam(&attr, &param);
+    }
+
+    // CPU affinity
+    if(!result && cpuMask){
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for(int n = 0; n < 64; ++n){
+            if(cpuMask & (uint64_t(1) << n)){
+                CPU_SET(n, &cpuSet);
+            }
+        }
+        result = pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpuSet);
+    }
+
+    // Create the thread
+    if(!result){
+        result = pthread_create(&thread, &attr, &RealTimeThread::Entry, this);
+    }
+    (void) pthread_attr_destroy(&attr);
+    return result;
+}
+
+void* RealTimeThread::Entry(void* arg){
+    RealTimeThread* self = static_cast<RealTimeThread*>(arg);
+    (void) pthread_setname_np(pthread_self(), self->name.c_str());
+    self->function();
+    return nullptr;
+}
+#endif
+
@@ -0,0 +1,88 @@
+#pragma once
+
+
+#include <GenericTarget/GT_Common.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief This class represents a thread whose realtime attributes are set before the thread runs. Instead of starting a std::thread
+ * and changing its scheduling afterwards, the thread is created with a prepared pthread attribute object: explicit scheduling (SCHED_FIFO
+ * with the given priority), CPU affinity and a stack that is allocated in advance. If memory locking is enabled, the top of the stack is
+ * prefaulted by the creating thread. The thread is named, such that tools like top or perf show the name instead of the binary name.
+ * If the operating system refuses an attribute (e.g. missing privileges), the thread is created without this attribute and a warning is printed.
+ */
+class RealTimeThread {
+    public:
+        /**
+         * @brief Create a realtime thread object. No thread is started.
+         */
+        RealTimeThread();
+
+        /**
+         * @brief Wait for the thread to finish and release its stack.
+         */
+        ~RealTimeThread();
+
+        /**
+         * @brief Start the thread.
+         * @param [in] function The function to be executed by the thread.
+         * @param [in] name Name of the thread. Only the first 15 characters are used.
+         * @param [in] priority SCHED_FIFO priority of the thread or a non-positive value for default scheduling.
+         * @param [in] cpuMask CPU core bitmask, where bit n indicates CPU core n. If this value is zero, the thread may run on all CPU cores.
+         * @return True if success, false if the thread could not be created.
+         * @details The thread must have been joined by @ref Join before it is started again. On windows, name and CPU affinity are not supported.
+         */
+        bool Start(std::function<void(void)> function, std::string name, int priority, uint64_t cpuMask);
+
+        /**
+         * @brief Wait for the thread to finish and release its stack.
+         * @details This function has no effect if the thread has not been started.
+         */
+        void Join(void);
+
+        /**
+         * @brief Check whether the thread has been started and not yet been joined.
+         * @return True if the thread is joinable, false otherwise.
+         */
+        inline bool IsJoinable(void){ return started; }
+
+    private:
+        bool started;                          ///< True if the thread has been started and not yet been joined, false otherwise.
+        std::function<void(void)> function;    ///< The function to be executed by the thread.
+        std::string name;                      ///< The name of the thread.
+        #ifdef _WIN32
+        std::thread thread;                    ///< The thread object.
+        #else
+        pthread_t thread;                      ///< The thread handle.
+        void* stack;                           ///< The stack memory including the guard page at the lowest address or nullptr if no stack is allocated.
+        size_t stackSize;                      ///< Size of the stack memory in bytes including the guard page.
+
+        /**
+         * @brief Allocate the stack memory and prefault its top.
+         * @return True if success, false otherwise.
+         */
+        bool AllocateStack(void);
+
+        /**
+         * @brief Create the thread with the given attributes.
+         * @param [in] priority SCHED_FIFO priority or a non-positive value for default scheduling.
+         * @param [in] cpuMask CPU core bitmask or zero if the thread may run on all CPU cores.
+         * @return Zero if success, an error number otherwise.
+         */
+        int Create(int priority, uint64_t cpuMask);
+
+        /**
+         * @brief Entry function of the thread.
+         * @param [in] arg Pointer to the realtime thread object.
+         * @return Always nullptr.
+         */
+        static void* Entry(void* arg);
+        #endif
+};
+
+
+} /* namespace: gt */
+
@@ -0,0 +1,143 @@
+#include <GenericTarget/GT_SampleOffsetTuner.hpp>
+#include <GenericTarget/GT_GenericTarget.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
+using namespace gt;
+
+
+SampleOffsetTuner::SampleOffsetTuner(){
+    terminate = false;
+    ready = false;
+    applied = false;
+}
+
+SampleOffsetTuner::~SampleOffsetTuner(){
+    Stop();
+}
+
+void SampleOffsetTuner::Start(const std::vector<PeriodicTask*>& tasks){
+    Stop();
+    if(!SimulinkInterface::autoSampleOffsets){
+        return;
+    }
+    this->tasks = tasks;
+    offsets.clear();
+    applied = false;
+    {
+        const std::lock_guard<std::mutex> lock(mtx);
+        terminate = false;
+    }
+    thread = std::thread(&SampleOffsetTuner::TunerThread, this);
+}
+
+void SampleOffsetTuner::Stop(void){
+    {
+        const std::lock_guard<std::mutex> lock(mtx);
+        terminate = true;
+    }
+    cv.notify_all();
+    if(thread.joinable()){
+        thread.join();
+    }
+    ready = false;
+    tasks.clear();
+}
+
+void SampleOffsetTuner::Update(uint64_t tick){
+    if(applied || !ready.load(std::memory_order_acquire)){
+        return;
+    }
+    for(size_t n = 0; n < tasks.size(); ++n){
+        if(offsets[n] != SimulinkInterface::sampleOffsetTicks[tasks[n]->taskID]){
+            tasks[n]->SetSampleOffset(offsets[n], tick);
+        }
+    }
+    applied = true;
+}
+
+void SampleOffsetTuner::TunerThread(void){
+    // Wait until each task has executed enough steps to estimate its CPU demand
+    std::vector<double> demands(tasks.size(), 0.0);
+    std::unique_lock<std::mutex> lock(mtx);
+    while(!terminate){
+        cv.wait_for(lock, std::chrono::milliseconds(GENERIC_TARGET_SAMPLE_OFFSET_INTERVAL_MS));
+        if(terminate){
+            return;
+        }
+        bool measured = true;
+        for(size_t n = 0; n < tasks.size(); ++n){
+            tasks[n]->UpdateExecutionTimePercentiles();
+            TaskStatisticsSnapshot statistics = tasks[n]->GetExecutionTimeStatistics();
+            measured &= (statistics.count >= GENERIC_TARGET_SAMPLE_OFFSET_NUM_STEPS);
+            demands[n] = std::max(statistics.p99, statistics.mean);
+        }
+        if(measured){
+            break;
+        }
+    }
+    lock.unlock();
+
+    // Compute the sample offsets and hand them over to the master thread
+    double peakBefore, peakAfter;
+    offsets = ComputeOffsets(demands, peakBefore, peakAfter);
+    ready.store(true, std::memory_order_release);
+    GENERIC_TARGET_PRINT("Sample offsets have been tuned (peak demand per tick: %.3lf us -> %.3lf us)\n", 1e6 * peakBefore, 1e6 * peakAfter);
+    for(size_t n = 0; n < tasks.size(); ++n){
+        GENERIC_TARGET_PRINT("  task \"%s\": sampleOffsetTicks=%u (demand=%.3lf us)\n", SimulinkInterface::taskNames[tasks[n]->taskID], offsets[n], 1e6 * demands[n]);
+    }
+}
+
+std::vector<uint32_t> SampleOffsetTuner::ComputeOffsets(const std::vector<double>& demands, double& peakBefore, double& peakAfter){
+    // Hyperperiod of all rates (limited to keep the computation short, which only approximates the peak of very long hyperperiods)
+    uint64_t numTicks = 1;
+    for(auto&& task : tasks){
+        numTicks = std::min(std::lcm(numTicks, static_cast<uint64_t>(SimulinkInterface::sampleTicks[task->taskID])), uint64_t(GENERIC_TARGET_SAMPLE_OFFSET_MAX_TICKS));
+    }
+
+    // Demand per tick with the sample offsets of the model
+    std::vector<uint32_t> result(tasks.size());
+    std::vector<double> load(numTicks, 0.0);
+    for(size_t n = 0; n < tasks.size(); ++n){
+        result[n] = SimulinkInterface::sampleOffsetTicks[tasks[n]->taskID];
+        for(uint64_t t = result[n]; t < numTicks; t += SimulinkInterface::sampleTicks[tasks[n]->taskID]){
+            load[t] += demands[n];
+        }
+    }
+    peakBefore = *std::max_element(load.begin(), load.end());
+
+    // Place tasks of the base rate and tasks with model offsets first, then all other tasks with the largest demand first
+    std::vector<size_t> order;
+    std::fill(load.begin(), load.end(), 0.0);
+    for(size_t n = 0; n < tasks.size(); ++n){
+        uint32_t period = static_cast<uint32_t>(SimulinkInterface::sampleTicks[tasks[n]->taskID]);
+        if((period < 2) || result[n]){
+            for(uint64_t t = result[n]; t < numTicks; t += period){
+                load[t] += demands[n];
+            }
+            continue;
+        }
+        order.push_back(n);
+    }
+    std::stable_sort(order.begin(), order.end(), [&demands](size_t a, size_t b){ return demands[a] > demands[b]; });
+
+    // Each task gets the offset whose ticks have the lowest peak demand so far
+    for(auto&& n : order){
+        uint32_t period = static_cast<uint32_t>(SimulinkInterface::sampleTicks[tasks[n]->taskID]);
+        double bestPeak = std::numeric_limits<double>::infinity();
+        for(uint32_t offset = 0; offset < period; ++offset){
+            double peak = 0.0;
+            for(uint64_t t = offset; t < numTicks; t += period){
+                peak = std::max(peak, load[t]);
+            }
+            if(peak < bestPeak){
+                bestPeak = peak;
+                result[n] = offset;
+            }
+        }
+        for(uint64_t t = result[n]; t < numTicks; t += period){
+            load[t] += demands[n];
+        }
+    }
+    peakAfter = *std::max_element(load.begin(), load.end());
+    return result;
+}
+
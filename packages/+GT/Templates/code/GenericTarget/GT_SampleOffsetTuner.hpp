@@ -0,0 +1,76 @@
+#pragma once
+
+
+#include <GenericTarget/GT_PeriodicTask.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief The sample offset tuner spreads the activations of slower tasks over the ticks of the master clock. By default, all rates are
+ * notified at tick zero, such that every common multiple of the sample ticks sees the worst-case pile-up of all step functions. The tuner
+ * waits until each task has executed a number of steps, takes the 99th percentile of the execution time as CPU demand of a task and
+ * greedily assigns a sample offset to each task (largest demand first), such that the peak demand per tick over the hyperperiod is minimal.
+ * Tasks of the base rate and tasks with a sample offset defined by the model keep their phase. The offsets are computed by a separate
+ * thread with default priority and applied once by the thread that waits for the ticks of the master clock.
+ */
+class SampleOffsetTuner {
+    public:
+        /**
+         * @brief Create the sample offset tuner.
+         */
+        SampleOffsetTuner();
+
+        /**
+         * @brief Stop the sample offset tuner.
+         */
+        ~SampleOffsetTuner();
+
+        /**
+         * @brief Start the thread that measures the tasks and computes the sample offsets.
+         * @param [in] tasks All periodic tasks. The tasks must not be deleted before @ref Stop is called.
+         * @details The tuner is not started if automatic sample offsets are disabled.
+         */
+        void Start(const std::vector<PeriodicTask*>& tasks);
+
+        /**
+         * @brief Stop the thread of the sample offset tuner.
+         */
+        void Stop(void);
+
+        /**
+         * @brief Apply the computed sample offsets as soon as they are available.
+         * @param [in] tick The index of the tick at which all tasks have just been notified (counted from zero).
+         * @details This function must be called by the thread that waits for the ticks of the master clock.
+         */
+        void Update(uint64_t tick);
+
+    private:
+        std::thread thread;                         ///< The tuner thread.
+        std::mutex mtx;                             ///< Mutex for the condition variable.
+        std::condition_variable cv;                 ///< Wakes up the tuner thread if it should be terminated.
+        bool terminate;                             ///< True if the tuner thread should be terminated (protected by @ref mtx).
+        std::vector<PeriodicTask*> tasks;           ///< All periodic tasks.
+        std::vector<uint32_t> offsets;              ///< The computed sample offsets in ticks (one for each task), written by the tuner thread before @ref ready is set.
+        std::atomic<bool> ready;                    ///< True if the sample offsets have been computed and are to be applied.
+        bool applied;                               ///< True if the sample offsets have been applied to the tasks.
+
+        /**
+         * @brief The tuner thread function.
+         */
+        void TunerThread(void);
+
+        /**
+         * @brief Compute the sample offsets for a given CPU demand of all tasks.
+         * @param [in] demands The CPU demand of each task in seconds.
+         * @param [out] peakBefore Peak demand per tick in seconds with the sample offsets of the model.
+         * @param [out] peakAfter Peak demand per tick in seconds with the computed sample offsets.
+         * @return The computed sample offsets in ticks (one for each task).
+         */
+        std::vector<uint32_t> ComputeOffsets(const std::vector<double>& demands, double& peakBefore, double& peakAfter);
+};
+
+
+} /* namespace: gt */
+
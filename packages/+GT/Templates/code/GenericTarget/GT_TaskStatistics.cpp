@@ -0,0 +1,110 @@
+#include <GenericTarget/GT_TaskStatistics.hpp>
+using namespace gt;
+
+
+TaskStatistics::TaskStatistics(){
+    Reset();
+}
+
+void TaskStatistics::Reset(void){
+    sequence = 0;
+    count = 0;
+    numOverBudget = 0;
+    last = 0.0;
+    minimum = 0.0;
+    maximum = 0.0;
+    mean = 0.0;
+    sumSquares = 0.0;
+    cpuTime = 0.0;
+    preemptedTime = 0.0;
+    maxPreemptedTime = 0.0;
+    sumPreemptedTime = 0.0;
+    numVoluntaryContextSwitches = 0;
+    numInvoluntaryContextSwitches = 0;
+    numMinorFaults = 0;
+    numMajorFaults = 0;
+    p99 = 0.0;
+    p999 = 0.0;
+    histogram.Reset();
+}
+
+void TaskStatistics::Record(int64_t nanoseconds, int64_t cpuNanoseconds, const ResourceUsage& usage, int64_t budgetNanoseconds){
+    histogram.Record(nanoseconds);
+    double value = 1e-9 * double(std::max(int64_t(0), nanoseconds));
+    double cpu = 1e-9 * double(std::max(int64_t(0), cpuNanoseconds));
+    double preempted = 1e-9 * double(std::max(int64_t(0), nanoseconds - cpuNanoseconds));
+
+    // Begin write: odd sequence number
+    uint32_t s = sequence.load(std::memory_order_relaxed);
+    sequence.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // Welford's online algorithm for mean and variance
+    uint64_t n = count.load(std::memory_order_relaxed) + 1;
+    double m = mean.load(std::memory_order_relaxed);
+    double delta = value - m;
+    m += delta / double(n);
+    sumSquares.store(sumSquares.load(std::memory_order_relaxed) + delta * (value - m), std::memory_order_relaxed);
+    mean.store(m, std::memory_order_relaxed);
+    count.store(n, std::memory_order_relaxed);
+    last.store(value, std::memory_order_relaxed);
+    if((1 == n) || (value < minimum.load(std::memory_order_relaxed))){
+        minimum.store(value, std::memory_order_relaxed);
+    }
+    if(value > maximum.load(std::memory_order_relaxed)){
+        maximum.store(value, std::memory_order_relaxed);
+    }
+    if(nanoseconds > budgetNanoseconds){
+        numOverBudget.store(numOverBudget.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // CPU time, preempted time and resource usage
+    cpuTime.store(cpu, std::memory_order_relaxed);
+    preemptedTime.store(preempted, std::memory_order_relaxed);
+    sumPreemptedTime.store(sumPreemptedTime.load(std::memory_order_relaxed) + preempted, std::memory_order_relaxed);
+    if(preempted > maxPreemptedTime.load(std::memory_order_relaxed)){
+        maxPreemptedTime.store(preempted, std::memory_order_relaxed);
+    }
+    numVoluntaryContextSwitches.store(numVoluntaryContextSwitches.load(std::memory_order_relaxed) + usage.numVoluntaryContextSwitches, std::memory_order_relaxed);
+    numInvoluntaryContextSwitches.store(numInvoluntaryContextSwitches.load(std::memory_order_relaxed) + usage.numInvoluntaryContextSwitches, std::memory_order_relaxed);
+    numMinorFaults.store(numMinorFaults.load(std::memory_order_relaxed) + usage.numMinorFaults, std::memory_order_relaxed);
+    numMajorFaults.store(numMajorFaults.load(std::memory_order_relaxed) + usage.numMajorFaults, std::memory_order_relaxed);
+
+    // End write: even sequence number
+    sequence.store(s + 2, std::memory_order_release);
+}
+
+TaskStatisticsSnapshot TaskStatistics::GetSnapshot(void) const {
+    TaskStatisticsSnapshot snapshot;
+    uint32_t s1, s2;
+    do {
+        s1 = sequence.load(std::memory_order_acquire);
+        snapshot.count = count.load(std::memory_order_relaxed);
+        snapshot.numOverBudget = numOverBudget.load(std::memory_order_relaxed);
+        snapshot.last = last.load(std::memory_order_relaxed);
+        snapshot.min = minimum.load(std::memory_order_relaxed);
+        snapshot.max = maximum.load(std::memory_order_relaxed);
+        snapshot.mean = mean.load(std::memory_order_relaxed);
+        snapshot.variance = sumSquares.load(std::memory_order_relaxed);
+        snapshot.cpuTime = cpuTime.load(std::memory_order_relaxed);
+        snapshot.preemptedTime = preemptedTime.load(std::memory_order_relaxed);
+        snapshot.maxPreemptedTime = maxPreemptedTime.load(std::memory_order_relaxed);
+        snapshot.sumPreemptedTime = sumPreemptedTime.load(std::memory_order_relaxed);
+        snapshot.usage.numVoluntaryContextSwitches = numVoluntaryContextSwitches.load(std::memory_order_relaxed);
+        snapshot.usage.numInvoluntaryContextSwitches = numInvoluntaryContextSwitches.load(std::memory_order_relaxed);
+        snapshot.usage.numMinorFaults = numMinorFaults.load(std::memory_order_relaxed);
+        snapshot.usage.numMajorFaults = numMajorFaults.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        s2 = sequence.load(std::memory_order_relaxed);
+    } while((s1 & 1) || (s1 != s2));
+    snapshot.variance = (snapshot.count > 1) ? (snapshot.variance / double(snapshot.count - 1)) : 0.0;
+    snapshot.p99 = p99.load(std::memory_order_relaxed);
+    snapshot.p999 = p999.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void TaskStatistics::UpdatePercentiles(void){
+    p99.store(histogram.GetPercentile(99.0), std::memory_order_relaxed);
+    p999.store(histogram.GetPercentile(99.9), std::memory_order_relaxed);
+}
+
@@ -0,0 +1,120 @@
+#pragma once
+
+
+#include <GenericTarget/GT_LatencyHistogram.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief A consistent snapshot of the execution time statistics of a task.
+ */
+struct TaskStatisticsSnapshot {
+    uint64_t count;           ///< Number of steps.
+    uint64_t numOverBudget;   ///< Number of steps whose execution time exceeded the execution time budget of the task.
+    double last;              ///< Execution time of the latest step in seconds.
+    double min;               ///< Minimum execution time in seconds.
+    double max;               ///< Maximum execution time in seconds.
+    double mean;              ///< Mean execution time in seconds.
+    double variance;          ///< Variance of the execution time in seconds^2.
+    double p99;               ///< 99th percentile of the execution time in seconds as of the latest @ref TaskStatistics::UpdatePercentiles.
+    double p999;              ///< 99.9th percentile of the execution time in seconds as of the latest @ref TaskStatistics::UpdatePercentiles.
+    double cpuTime;           ///< CPU time of the latest step in seconds.
+    double preemptedTime;     ///< Preempted time of the latest step in seconds, e.g. execution time minus CPU time.
+    double maxPreemptedTime;  ///< Maximum preempted time in seconds.
+    double sumPreemptedTime;  ///< Total preempted time of all steps in seconds.
+    ResourceUsage usage;      ///< Total resource usage counters of all steps (only counted if resource usage measurement is enabled).
+};
+
+
+/**
+ * @brief Execution time statistics of a task. In addition to the wall-clock execution time, the CPU time of the thread is recorded. The
+ * difference between both is the time during which the thread was preempted, e.g. by an IRQ thread or a thread with higher priority. Exactly one thread updates the statistics after each step via @ref Record, which is lock-free
+ * and does not allocate memory. Any other thread obtains torn-free snapshots via @ref GetSnapshot, which uses a sequence lock (seqlock).
+ * The percentiles are not computed by @ref GetSnapshot but cached by @ref UpdatePercentiles, which is called periodically by a low-priority thread.
+ */
+class TaskStatistics {
+    public:
+        /**
+         * @brief Create empty task statistics.
+         */
+        TaskStatistics();
+
+        /**
+         * @brief Reset all statistics.
+         * @details This function must not be called while another thread records values.
+         */
+        void Reset(void);
+
+        /**
+         * @brief Record the execution time of one step.
+         * @param [in] nanoseconds The execution time in nanoseconds.
+         * @param [in] cpuNanoseconds The CPU time of the thread during the step in nanoseconds.
+         * @param [in] usage The resource usage counters of the thread during the step (difference between the end and the start of the step).
+         * @param [in] budgetNanoseconds The execution time budget in nanoseconds. If the execution time is greater than this value, the step is counted as over budget.
+         */
+        void Record(int64_t nanoseconds, int64_t cpuNanoseconds, const ResourceUsage& usage, int64_t budgetNanoseconds);
+
+        /**
+         * @brief Get a consistent snapshot of the statistics.
+         * @return Snapshot of the statistics. The percentiles are the cached values of the latest call to @ref UpdatePercentiles.
+         * @details This function is cheap and may be called by the threads that execute the model.
+         */
+        TaskStatisticsSnapshot GetSnapshot(void) const;
+
+        /**
+         * @brief Compute the percentiles from the histogram of execution times and cache them for @ref GetSnapshot.
+         * @details This function walks all buckets of the histogram and must not be called by the threads that execute the model.
+         */
+        void UpdatePercentiles(void);
+
+        /**
+         * @brief Get the execution time of the latest step.
+         * @return Execution time of the latest step in seconds.
+         */
+        inline double GetLast(void) const { return last.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Get the CPU time of the latest step.
+         * @return CPU time of the latest step in seconds.
+         */
+        inline double GetLastCPUTime(void) const { return cpuTime.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Get the number of steps over budget.
+         * @return Number of steps whose execution time exceeded the execution time budget.
+         */
+        inline uint64_t GetNumOverBudget(void) const { return numOverBudget.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Get the histogram of execution times.
+         * @return Histogram of execution times.
+         */
+        inline const LatencyHistogram& GetHistogram(void) const { return histogram; }
+
+    private:
+        std::atomic<uint32_t> sequence;        ///< Sequence counter of the seqlock, odd while the writer updates the statistics.
+        std::atomic<uint64_t> count;           ///< Number of steps.
+        std::atomic<uint64_t> numOverBudget;   ///< Number of steps over budget.
+        std::atomic<double> last;              ///< Latest execution time in seconds.
+        std::atomic<double> minimum;           ///< Minimum execution time in seconds.
+        std::atomic<double> maximum;           ///< Maximum execution time in seconds.
+        std::atomic<double> mean;              ///< Running mean in seconds (Welford).
+        std::atomic<double> sumSquares;        ///< Running sum of squared differences from the mean (Welford).
+        std::atomic<double> cpuTime;           ///< Latest CPU time in seconds.
+        std::atomic<double> preemptedTime;     ///< Latest preempted time in seconds.
+        std::atomic<double> maxPreemptedTime;  ///< Maximum preempted time in seconds.
+        std::atomic<double> sumPreemptedTime;  ///< Total preempted time in seconds.
+        std::atomic<uint64_t> numVoluntaryContextSwitches;     ///< Total number of voluntary context switches.
+        std::atomic<uint64_t> numInvoluntaryContextSwitches;   ///< Total number of involuntary context switches.
+        std::atomic<uint64_t> numMinorFaults;                  ///< Total number of minor page faults.
+        std::atomic<uint64_t> numMajorFaults;                  ///< Total number of major page faults.
+        std::atomic<double> p99;               ///< Cached 99th percentile of the execution time in seconds.
+        std::atomic<double> p999;              ///< Cached 99.9th percentile of the execution time in seconds.
+        LatencyHistogram histogram;            ///< Histogram of execution times.
+};
+
+
+} /* namespace: gt */
+
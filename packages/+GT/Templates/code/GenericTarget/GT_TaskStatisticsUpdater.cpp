@@ -0,0 +1,49 @@
+#include <GenericTarget/GT_TaskStatisticsUpdater.hpp>
+using namespace gt;
+
+
+TaskStatisticsUpdater::TaskStatisticsUpdater(){
+    terminate = false;
+}
+
+TaskStatisticsUpdater::~TaskStatisticsUpdater(){
+    Stop();
+}
+
+void TaskStatisticsUpdater::Start(const std::vector<PeriodicTask*>& tasks){
+    Stop();
+    this->tasks = tasks;
+    {
+        const std::lock_guard<std::mutex> lock(mtx);
+        terminate = false;
+    }
+
+    // The updater keeps the default (non-realtime) priority, it must never delay the model
+    thread = std::thread(&TaskStatisticsUpdater::UpdaterThread, this);
+}
+
+void TaskStatisticsUpdater::Stop(void){
+    {
+        const std::lock_guard<std::mutex> lock(mtx);
+        terminate = true;
+    }
+    cv.notify_all();
+    if(thread.joinable()){
+        thread.join();
+    }
+    tasks.clear();
+}
+
+void TaskStatisticsUpdater::UpdaterThread(void){
+    std::unique_lock<std::mutex> lock(mtx);
+    while(!terminate){
+        cv.wait_for(lock, std::chrono::milliseconds(GENERIC_TARGET_TASK_STATISTICS_INTERVAL_MS));
+        if(terminate){
+            break;
+        }
+        for(auto&& task : tasks){
+            task->UpdateExecutionTimePercentiles();
+        }
+    }
+}
+
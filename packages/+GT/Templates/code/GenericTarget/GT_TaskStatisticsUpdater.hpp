@@ -0,0 +1,53 @@
+#pragma once
+
+
+#include <GenericTarget/GT_PeriodicTask.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief The task statistics updater periodically refreshes the execution time percentiles of all periodic tasks. Computing a percentile walks
+ * all buckets of the execution time histogram, which is too expensive for the threads that execute the model. Readers of the task statistics,
+ * e.g. the Task Execution Time driver block, obtain the cached percentiles of the latest refresh instead.
+ */
+class TaskStatisticsUpdater {
+    public:
+        /**
+         * @brief Create the task statistics updater.
+         */
+        TaskStatisticsUpdater();
+
+        /**
+         * @brief Stop the task statistics updater.
+         */
+        ~TaskStatisticsUpdater();
+
+        /**
+         * @brief Start the updater thread.
+         * @param [in] tasks All periodic tasks whose percentiles are to be refreshed. The tasks must not be deleted before @ref Stop is called.
+         */
+        void Start(const std::vector<PeriodicTask*>& tasks);
+
+        /**
+         * @brief Stop the updater thread.
+         */
+        void Stop(void);
+
+    private:
+        std::thread thread;                         ///< The updater thread.
+        std::mutex mtx;                             ///< Mutex for the condition variable.
+        std::condition_variable cv;                 ///< Wakes up the updater thread if it should be terminated.
+        bool terminate;                             ///< True if the updater thread should be terminated (protected by @ref mtx).
+        std::vector<PeriodicTask*> tasks;           ///< All tasks whose percentiles are refreshed.
+
+        /**
+         * @brief The updater thread function.
+         */
+        void UpdaterThread(void);
+};
+
+
+} /* namespace: gt */
+
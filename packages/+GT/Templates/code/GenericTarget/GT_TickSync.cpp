@@ -0,0 +1,146 @@
+#include <GenericTarget/GT_TickSync.hpp>
+#include <GenericTarget/GT_GenericTarget.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
+using namespace gt;
+
+
+/* Layout of a beacon (host byte order): magic "GTSY", tick counter (uint64), ideal time of the tick (double), delay from the ideal time of the tick to the send time (double), base sampletime (double) */
+static constexpr uint32_t TICK_SYNC_BEACON_SIZE = 36;
+static constexpr uint32_t TICK_SYNC_NUM_BUFFERS = 8;
+static constexpr uint8_t TICK_SYNC_MAGIC[4] = {0x47, 0x54, 0x53, 0x59};
+
+
+TickSync::TickSync(){
+    mode = tick_sync_mode::NONE;
+    sources.resize(5 * TICK_SYNC_NUM_BUFFERS);
+    bytes.resize(TICK_SYNC_BEACON_SIZE * TICK_SYNC_NUM_BUFFERS);
+    lengths.resize(TICK_SYNC_NUM_BUFFERS);
+    timestamps.resize(TICK_SYNC_NUM_BUFFERS);
+    Reset();
+}
+
+void TickSync::Register(void){
+    mode = static_cast<tick_sync_mode>(SimulinkInterface::tickSyncMode);
+    if(tick_sync_mode::NONE == mode){
+        return;
+    }
+    UDPConfiguration conf;
+    conf.multicast.group = {SimulinkInterface::tickSyncGroup[0], SimulinkInterface::tickSyncGroup[1], SimulinkInterface::tickSyncGroup[2], SimulinkInterface::tickSyncGroup[3]};
+    conf.multicast.interfaceJoinIP = {SimulinkInterface::tickSyncInterface[0], SimulinkInterface::tickSyncInterface[1], SimulinkInterface::tickSyncInterface[2], SimulinkInterface::tickSyncInterface[3]};
+    conf.multicast.interfaceSendIP = conf.multicast.interfaceJoinIP;
+    if(tick_sync_mode::MASTER == mode){
+        GenericTarget::udpMulticastManager.RegisterSender(SimulinkInterface::tickSyncPort, conf);
+    }
+    else{
+        conf.rxBufferSize = TICK_SYNC_BEACON_SIZE;
+        conf.priorityThread = GENERIC_TARGET_PRIORITY_TICK_SYNC;
+        conf.numBuffers = TICK_SYNC_NUM_BUFFERS;
+        conf.bufferStrategy = udp_buffer_strategy::DISCARD_OLDEST;
+        GenericTarget::udpMulticastManager.RegisterReceiver(SimulinkInterface::tickSyncPort, conf);
+    }
+    GENERIC_TARGET_PRINT("Tick synchronization registered as %s (group=%u.%u.%u.%u, port=%u, interval=%u)\n", (tick_sync_mode::MASTER == mode) ? "master" : "slave", conf.multicast.group[0], conf.multicast.group[1], conf.multicast.group[2], conf.multicast.group[3], SimulinkInterface::tickSyncPort, SimulinkInterface::tickSyncInterval);
+}
+
+void TickSync::Reset(void){
+    const std::lock_guard<std::mutex> lock(mtxStatus);
+    status.phaseError = 0.0;
+    status.locked = false;
+    status.periodAdjustment = 0.0;
+    status.numBeacons = 0;
+    integrator = 0.0;
+    numLockedBeacons = 0;
+    tickOfLatestBeacon = 0;
+}
+
+void TickSync::Update(PeriodicTimer& timer, uint64_t tick){
+    if(tick_sync_mode::MASTER == mode){
+        if(0 == (tick % uint64_t(std::max(uint32_t(1), SimulinkInterface::tickSyncInterval)))){
+            SendBeacon(timer, tick);
+        }
+    }
+    else if(tick_sync_mode::SLAVE == mode){
+        ReceiveBeacons(timer, tick);
+    }
+}
+
+TickSyncStatus TickSync::GetStatus(void){
+    const std::lock_guard<std::mutex> lock(mtxStatus);
+    return status;
+}
+
+void TickSync::SendBeacon(PeriodicTimer& timer, uint64_t tick){
+    // The delay between the ideal time of the tick and the send time allows the slaves to remove the wakeup latency of the master
+    double timeOfTick = timer.GetTimeOfTick();
+    double sendDelay = timer.GetTimeToStart() - timeOfTick;
+    uint8_t beacon[TICK_SYNC_BEACON_SIZE];
+    std::memcpy(&beacon[0], &TICK_SYNC_MAGIC[0], 4);
+    std::memcpy(&beacon[4], &tick, 8);
+    std::memcpy(&beacon[12], &timeOfTick, 8);
+    std::memcpy(&beacon[20], &sendDelay, 8);
+    std::memcpy(&beacon[28], &SimulinkInterface::baseSampleTime, 8);
+    const uint16_t destination[5] = {SimulinkInterface::tickSyncGroup[0], SimulinkInterface::tickSyncGroup[1], SimulinkInterface::tickSyncGroup[2], SimulinkInterface::tickSyncGroup[3], SimulinkInterface::tickSyncPort};
+    auto [tx, errorCode] = GenericTarget::udpMulticastManager.Send(SimulinkInterface::tickSyncPort, &destination[0], &beacon[0], TICK_SYNC_BEACON_SIZE);
+    if(tx != static_cast<int32_t>(TICK_SYNC_BEACON_SIZE)){
+        (void) errorCode;
+        return;
+    }
+    const std::lock_guard<std::mutex> lock(mtxStatus);
+    status.numBeacons++;
+}
+
+void TickSync::ReceiveBeacons(PeriodicTimer& timer, uint64_t tick){
+    uint32_t numReceived = 0;
+    uint32_t numDiscarded = 0;
+    (void) GenericTarget::udpMulticastManager.Receive(SimulinkInterface::tickSyncPort, &sources[0], &bytes[0], &lengths[0], &timestamps[0], &numReceived, &numDiscarded, TICK_SYNC_BEACON_SIZE, TICK_SYNC_NUM_BUFFERS);
+
+    // Lose the lock if no beacon has been received for a while
+    const uint64_t interval = uint64_t(std::max(uint32_t(1), SimulinkInterface::tickSyncInterval));
+    if(!numReceived){
+        if((tick - tickOfLatestBeacon) > (GENERIC_TARGET_TICK_SYNC_TIMEOUT * interval)){
+            const std::lock_guard<std::mutex> lock(mtxStatus);
+            if(status.locked){
+                GENERIC_TARGET_PRINT_WARNING("Tick synchronization lost the lock: no beacon received for %lu ticks\n", tick - tickOfLatestBeacon);
+            }
+            status.locked = false;
+            numLockedBeacons = 0;
+        }
+        return;
+    }
+
+    // Only the latest valid beacon is used
+    const double period = SimulinkInterface::baseSampleTime;
+    for(uint32_t n = numReceived; n > 0; --n){
+        const uint8_t* beacon = &bytes[(n - 1) * TICK_SYNC_BEACON_SIZE];
+        double sendDelay, masterPeriod;
+        std::memcpy(&sendDelay, &beacon[20], 8);
+        std::memcpy(&masterPeriod, &beacon[28], 8);
+        if((TICK_SYNC_BEACON_SIZE != lengths[n - 1]) || (0 != std::memcmp(beacon, &TICK_SYNC_MAGIC[0], 4)) || (std::fabs(masterPeriod - period) > 1e-9)){
+            continue;
+        }
+
+        // Phase of the master tick with respect to the latest local tick, wrapped to [-period/2, period/2)
+        double phase = timestamps[n - 1] - sendDelay - SimulinkInterface::tickSyncLatency - timer.GetTimeOfTick();
+        double phaseError = phase - period * std::floor(phase / period + 0.5);
+
+        // PI controller: the proportional part removes a fraction of the phase error during the next interval, the integral part compensates the frequency offset
+        integrator += GENERIC_TARGET_TICK_SYNC_GAIN_I * phaseError / double(interval);
+        const double maxAdjustment = GENERIC_TARGET_TIMER_PHASE_MAX_CORRECTION * period;
+        integrator = std::clamp(integrator, -maxAdjustment, maxAdjustment);
+        timer.SetPeriodAdjustment(GENERIC_TARGET_TICK_SYNC_GAIN_P * phaseError / double(interval) + integrator);
+
+        // Update lock status
+        tickOfLatestBeacon = tick;
+        const std::lock_guard<std::mutex> lock(mtxStatus);
+        numLockedBeacons = (std::fabs(phaseError) < (GENERIC_TARGET_TICK_SYNC_LOCK_THRESHOLD * period)) ? (numLockedBeacons + 1) : 0;
+        bool locked = (numLockedBeacons >= GENERIC_TARGET_TICK_SYNC_LOCK_COUNT);
+        if(locked != status.locked){
+            GENERIC_TARGET_PRINT("Tick synchronization %s (phase error=%.3lf us)\n", locked ? "locked" : "lost the lock", 1e6 * phaseError);
+        }
+        status.locked = locked;
+        status.phaseError = phaseError;
+        status.periodAdjustment = timer.GetPeriodAdjustment();
+        status.numBeacons++;
+        break;
+    }
+}
+
@@ -0,0 +1,99 @@
+#pragma once
+
+
+#include <GenericTarget/GT_PeriodicTimer.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief This enumeration represents the role of a target in the tick synchronization.
+ */
+enum class tick_sync_mode : uint32_t {
+    NONE = 0,                 ///< No tick synchronization.
+    MASTER = 1,               ///< Send a sync beacon via UDP multicast every N ticks.
+    SLAVE = 2                 ///< Receive sync beacons and keep the ticks phase-locked to the master by adjusting the period of the master clock.
+};
+
+
+/**
+ * @brief A consistent snapshot of the tick synchronization status.
+ */
+struct TickSyncStatus {
+    double phaseError;        ///< Phase error of the latest beacon in seconds (positive if the ticks of the master are later than the ticks of this target).
+    bool locked;              ///< True if the phase error has been below the lock threshold for several consecutive beacons.
+    double periodAdjustment;  ///< Time in seconds that is currently added to the base sampletime.
+    uint64_t numBeacons;      ///< Number of beacons that have been sent (master) or received (slave).
+};
+
+
+/**
+ * @brief The tick synchronization keeps the base-rate ticks of several targets phase-locked without PTP. The master target sends a small beacon
+ * via the @ref UDPMulticastManager every N ticks. The beacon contains the tick counter, the ideal time of the tick and the delay between the
+ * ideal time of the tick and the actual send time. Slave targets measure the phase of the received beacons with respect to their own ticks
+ * and run a PI controller (PLL) that adjusts the period of their @ref PeriodicTimer.
+ */
+class TickSync {
+    public:
+        /**
+         * @brief Create the tick synchronization.
+         */
+        TickSync();
+
+        /**
+         * @brief Register the multicast socket of the tick synchronization at the UDP multicast manager.
+         * @details This function must be called before the UDP multicast manager creates all sockets. It has no effect if the tick synchronization is disabled.
+         */
+        void Register(void);
+
+        /**
+         * @brief Reset the tick synchronization, e.g. before the master clock is started.
+         */
+        void Reset(void);
+
+        /**
+         * @brief Update the tick synchronization after a tick of the master clock.
+         * @param [in] timer The master clock.
+         * @param [in] tick The tick counter of the master clock (zero for the first tick).
+         * @details As master, a beacon is sent every N ticks. As slave, all received beacons are processed and the period of the master clock is adjusted.
+         * This function must be called by the thread that waits for the ticks of the master clock.
+         */
+        void Update(PeriodicTimer& timer, uint64_t tick);
+
+        /**
+         * @brief Get a consistent snapshot of the tick synchronization status.
+         * @return The tick synchronization status.
+         */
+        TickSyncStatus GetStatus(void);
+
+    private:
+        tick_sync_mode mode;                        ///< The role of this target.
+        std::mutex mtxStatus;                       ///< Protect the @ref status.
+        TickSyncStatus status;                      ///< The current tick synchronization status.
+        double integrator;                          ///< Integral part of the PI controller in seconds per tick.
+        uint32_t numLockedBeacons;                  ///< Number of consecutive beacons whose phase error was below the lock threshold.
+        uint64_t tickOfLatestBeacon;                ///< Local tick counter at which the latest beacon has been received.
+        std::vector<uint16_t> sources;              ///< Receive buffer for the sources of beacons.
+        std::vector<uint8_t> bytes;                 ///< Receive buffer for the bytes of beacons.
+        std::vector<uint32_t> lengths;              ///< Receive buffer for the lengths of beacons.
+        std::vector<double> timestamps;             ///< Receive buffer for the timestamps of beacons.
+
+        /**
+         * @brief Send a beacon (master).
+         * @param [in] timer The master clock.
+         * @param [in] tick The tick counter of the master clock.
+         */
+        void SendBeacon(PeriodicTimer& timer, uint64_t tick);
+
+        /**
+         * @brief Receive all beacons and adjust the period of the master clock (slave).
+         * @param [in] timer The master clock.
+         * @param [in] tick The tick counter of the master clock.
+         */
+        void ReceiveBeacons(PeriodicTimer& timer, uint64_t tick);
+};
+
+
+} /* namespace: gt */
+
@@ -0,0 +1,129 @@
+#include <GenericTarget/GT_Trace.hpp>
+#include <GenericTarget/GT_GenericTarget.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
+using namespace gt;
+
+
+thread_local TraceRing* Trace::ring = nullptr;
+std::mutex Trace::mtxRings;
+std::vector<TraceRing*> Trace::rings;
+
+
+TraceRing::TraceRing(uint32_t capacity): records(std::bit_ceil(std::max(uint32_t(2), capacity))), mask(records.size() - 1){
+    inUse = false;
+    head = 0;
+}
+
+void TraceRing::GetSnapshot(std::vector<TraceRecord>& snapshot) const {
+    // Copy the ring, then drop the records that the writer may have overwritten during the copy (including the one it is writing right now)
+    const uint64_t capacity = mask + 1;
+    const uint64_t h1 = head.load(std::memory_order_acquire);
+    const uint64_t first = (h1 > capacity) ? (h1 - capacity) : 0;
+    snapshot.resize(h1 - first);
+    for(uint64_t i = first; i < h1; ++i){
+        snapshot[i - first] = records[i & mask];
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t h2 = head.load(std::memory_order_relaxed);
+    const uint64_t firstValid = (h2 >= capacity) ? (h2 - capacity + 1) : 0;
+    if(firstValid > first){
+        snapshot.erase(snapshot.begin(), snapshot.begin() + std::min(snapshot.size(), size_t(firstValid - first)));
+    }
+}
+
+void Trace::RegisterThread(const std::string& name){
+    if(!SimulinkInterface::traceBufferSize){
+        return;
+    }
+    const std::lock_guard<std::mutex> lock(mtxRings);
+    if(ring){
+        ring->name = name;
+        return;
+    }
+    for(auto&& r : rings){
+        if(!r->inUse){
+            ring = r;
+            break;
+        }
+    }
+    if(!ring){
+        ring = new TraceRing(SimulinkInterface::traceBufferSize);
+        rings.push_back(ring);
+    }
+    ring->Clear();
+    ring->name = name;
+    ring->inUse = true;
+}
+
+void Trace::UnregisterThread(void){
+    const std::lock_guard<std::mutex> lock(mtxRings);
+    if(ring){
+        ring->inUse = false;
+        ring = nullptr;
+    }
+}
+
+bool Trace::Dump(void){
+    if(!SimulinkInterface::traceBufferSize){
+        GENERIC_TARGET_PRINT_WARNING("Cannot dump the trace because tracing is disabled!\n");
+        return false;
+    }
+    if(!GenericTarget::fileSystem.MakeTraceDirectory()){
+        return false;
+    }
+    std::string filename = GenericTarget::fileSystem.GetTraceFilename();
+    FILE* file = fopen(filename.c_str(), "w");
+    if(!file){
+        GENERIC_TARGET_PRINT_ERROR("Could not open trace file \"%s\"!\n", filename.c_str());
+        return false;
+    }
+
+    // Names are written as JSON strings
+    auto escape = [](const std::string& str){
+        std::string result;
+        for(auto&& c : str){
+            if(('"' == c) || ('\\' == c)) result.push_back('\\');
+            if(static_cast<unsigned char>(c) >= 0x20) result.push_back(c);
+        }
+        return result;
+    };
+    auto taskName = [&escape](uint32_t taskID){
+        return (taskID < SIMULINK_INTERFACE_NUM_TIMINGS) ? escape(SimulinkInterface::taskNames[taskID]) : std::to_string(taskID);
+    };
+
+    // One chrome trace event per record, one thread ID per ring
+    const std::lock_guard<std::mutex> lock(mtxRings);
+    std::vector<TraceRecord> snapshot;
+    size_t numEvents = 0;
+    bool first = true;
+    fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    for(size_t tid = 0; tid < rings.size(); ++tid){
+        fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}", first ? "" : ",", tid + 1, escape(rings[tid]->name).c_str());
+        first = false;
+        rings[tid]->GetSnapshot(snapshot);
+        for(auto&& r : snapshot){
+            std::string name, args;
+            switch(r.event){
+                case trace_event::TIMER_WAKEUP:   name = "timer wakeup";                     args = "\"tick\":" + std::to_string(r.argument); break;
+                case trace_event::NOTIFY:         name = "notify " + taskName(r.argument);   args = "\"task\":" + std::to_string(r.argument); break;
+                case trace_event::STEP:           name = "step " + taskName(r.argument);     args = "\"task\":" + std::to_string(r.argument); break;
+                case trace_event::RECORDER_FLUSH: name = "recorder flush";                   args = "\"appends\":" + std::to_string(r.argument); break;
+                case trace_event::UDP_RECEIVE:    name = "udp receive";                      args = "\"bytes\":" + std::to_string(r.argument); break;
+                case trace_event::UDP_SEND:       name = "udp send";                         args = "\"port\":" + std::to_string(r.argument); break;
+                default: continue;
+            }
+            fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"%c\",%s\"ts\":%.3lf,\"pid\":1,\"tid\":%lu,\"args\":{%s}}", name.c_str(), static_cast<char>(r.phase), (trace_phase::INSTANT == r.phase) ? "\"s\":\"t\"," : "", 1e-3 * double(r.timestamp), tid + 1, args.c_str());
+            numEvents++;
+        }
+    }
+    fprintf(file, "\n]}\n");
+    bool success = (0 == ferror(file));
+    fclose(file);
+    if(!success){
+        GENERIC_TARGET_PRINT_ERROR("Could not write trace file \"%s\"!\n", filename.c_str());
+        return false;
+    }
+    GENERIC_TARGET_PRINT("Trace with %lu events of %lu threads has been written to \"%s\"\n", numEvents, rings.size(), filename.c_str());
+    return true;
+}
+
@@ -0,0 +1,164 @@
+#pragma once
+
+
+#include <GenericTarget/GT_Common.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief This enumeration represents the events that are traced.
+ */
+enum class trace_event : uint8_t {
+    TIMER_WAKEUP = 0,         ///< The master thread woke up from the master clock (argument: tick counter).
+    NOTIFY = 1,               ///< A task has been activated by the base-rate scheduler (argument: task ID).
+    STEP = 2,                 ///< The step function of a task (argument: task ID).
+    RECORDER_FLUSH = 3,       ///< A data recording thread appends a batch of buffered samples to the data files (argument: number of appends in the batch).
+    UDP_RECEIVE = 4,          ///< A UDP message has been received (argument: number of bytes).
+    UDP_SEND = 5              ///< A UDP message is sent (argument: port of the socket).
+};
+
+
+/**
+ * @brief This enumeration represents the phase of a trace record (same characters as in the chrome trace format).
+ */
+enum class trace_phase : uint8_t {
+    BEGIN = 'B',              ///< Begin of a duration.
+    END = 'E',                ///< End of a duration.
+    INSTANT = 'i'             ///< Instant event.
+};
+
+
+/**
+ * @brief A fixed-size binary trace record.
+ */
+struct TraceRecord {
+    int64_t timestamp;        ///< Steady clock time (CLOCK_MONOTONIC) in nanoseconds.
+    uint32_t argument;        ///< Event-specific argument.
+    trace_event event;        ///< The event.
+    trace_phase phase;        ///< The phase of the event.
+    uint16_t reserved;        ///< Padding.
+};
+
+
+/**
+ * @brief A ring of trace records that is written by exactly one thread.
+ * @details Writing a record is wait-free: the record is stored and then the head is published with release semantics. A reader copies the ring and
+ * afterwards drops all records that may have been overwritten by the writer in the meantime.
+ */
+class TraceRing {
+    public:
+        /**
+         * @brief Create a trace ring.
+         * @param [in] capacity Number of records, rounded up to a power of two.
+         */
+        explicit TraceRing(uint32_t capacity);
+
+        /**
+         * @brief Write a record to the ring. Only the owning thread may call this function.
+         * @param [in] event The event.
+         * @param [in] phase The phase of the event.
+         * @param [in] argument Event-specific argument.
+         */
+        inline void Write(trace_event event, trace_phase phase, uint32_t argument){
+            const uint64_t h = head.load(std::memory_order_relaxed);
+            TraceRecord& record = records[h & mask];
+            record.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            record.argument = argument;
+            record.event = event;
+            record.phase = phase;
+            head.store(h + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Get a consistent copy of all records that are currently in the ring.
+         * @param [out] snapshot The records in chronological order.
+         */
+        void GetSnapshot(std::vector<TraceRecord>& snapshot) const;
+
+        /**
+         * @brief Remove all records. The owning thread must not write records during this call.
+         */
+        inline void Clear(void){ head = 0; }
+
+        std::string name;                           ///< Name of the owning thread.
+        bool inUse;                                 ///< True if the ring is owned by a running thread.
+
+    private:
+        std::vector<TraceRecord> records;           ///< All records (the capacity is a power of two).
+        const uint64_t mask;                        ///< Bitmask to obtain the index of a record from the head.
+        std::atomic<uint64_t> head;                 ///< Total number of records that have been written.
+};
+
+
+/**
+ * @brief The trace keeps the latest events of all realtime threads in per-thread lock-free rings. Each thread registers itself once, afterwards
+ * tracing an event costs one clock read and a few stores. On request, all rings are dumped to a chrome trace JSON file, which can be viewed in
+ * a timeline viewer (e.g. https://ui.perfetto.dev or chrome://tracing).
+ */
+class Trace {
+    public:
+        /**
+         * @brief Register the calling thread and allocate its trace ring.
+         * @param [in] name Name of the thread that is shown in the timeline.
+         * @details This function has no effect if tracing is disabled. Rings of unregistered threads are reused.
+         */
+        static void RegisterThread(const std::string& name);
+
+        /**
+         * @brief Unregister the calling thread. The records of the thread are kept until the ring is reused by another thread.
+         */
+        static void UnregisterThread(void);
+
+        /**
+         * @brief Trace an event of the calling thread.
+         * @param [in] event The event.
+         * @param [in] phase The phase of the event.
+         * @param [in] argument Event-specific argument.
+         * @details Events of threads that are not registered are ignored.
+         */
+        static inline void Event(trace_event event, trace_phase phase, uint32_t argument){
+            if(ring){
+                ring->Write(event, phase, argument);
+            }
+        }
+
+        /**
+         * @brief Dump the records of all threads to a chrome trace JSON file in the trace directory.
+         * @return True if success, false otherwise.
+         */
+        static bool Dump(void);
+
+    private:
+        static thread_local TraceRing* ring;        ///< The trace ring of the calling thread or nullptr if the thread is not registered.
+        static std::mutex mtxRings;                 ///< Protects @ref rings.
+        static std::vector<TraceRing*> rings;       ///< All trace rings (never deleted).
+};
+
+
+/**
+ * @brief Trace the begin of an event on construction and the end of the event on destruction.
+ */
+class TraceScope {
+    public:
+        /**
+         * @brief Trace the begin of an event.
+         * @param [in] event The event.
+         * @param [in] argument Event-specific argument.
+         */
+        TraceScope(trace_event event, uint32_t argument): event(event), argument(argument){ Trace::Event(event, trace_phase::BEGIN, argument); }
+
+        /**
+         * @brief Trace the end of the event.
+         */
+        ~TraceScope(){ Trace::Event(event, trace_phase::END, argument); }
+
+    private:
+        const trace_event event;                    ///< The traced event.
+        const uint32_t argument;                    ///< Event-specific argument.
+};
+
+
+} /* namespace: gt */
+
@@ -0,0 +1,89 @@
+#include <GenericTarget/GT_WakeupSignal.hpp>
+using namespace gt;
+
+
+#ifndef _WIN32
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex word must have a size of 32 bits!");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "The futex word must be lock-free!");
+
+/**
+ * @brief Block the calling thread as long as the futex word contains the expected value.
+ * @param [in] word The futex word.
+ * @param [in] expected The expected value of the futex word.
+ * @param [in] timeout Relative timeout or nullptr if the thread should block without a timeout.
+ */
+static inline void FutexWait(std::atomic<uint32_t>* word, uint32_t expected, const struct timespec* timeout){
+    (void) syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT_PRIVATE, expected, timeout, nullptr, 0);
+}
+
+/**
+ * @brief Wake up one thread that is blocked by the futex word.
+ * @param [in] word The futex word.
+ */
+static inline void FutexWakeOne(std::atomic<uint32_t>* word){
+    (void) syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+#endif
+
+
+WakeupSignal::WakeupSignal(){
+    sequence = 0;
+    numWaiters = 0;
+    consumed = 0;
+}
+
+void WakeupSignal::Notify(void){
+    #ifdef _WIN32
+    std::unique_lock<std::mutex> lock(mtx);
+    sequence.fetch_add(1);
+    cv.notify_one();
+    #else
+    sequence.fetch_add(1);
+    if(numWaiters.load()){
+        FutexWakeOne(&sequence);
+    }
+    #endif
+}
+
+void WakeupSignal::Wait(void){
+    #ifdef _WIN32
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [this](){ return this->TryConsume(); });
+    #else
+    while(!TryConsume()){
+        numWaiters.fetch_add(1);
+        FutexWait(&sequence, consumed, nullptr);
+        numWaiters.fetch_sub(1);
+    }
+    #endif
+}
+
+bool WakeupSignal::WaitFor(uint32_t timeoutMs){
+    #ifdef _WIN32
+    std::unique_lock<std::mutex> lock(mtx);
+    return cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this](){ return this->TryConsume(); });
+    #else
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while(!TryConsume()){
+        int64_t remainingNs = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now()).count();
+        if(remainingNs <= 0){
+            return false;
+        }
+        struct timespec timeout;
+        timeout.tv_sec = static_cast<time_t>(remainingNs / 1000000000);
+        timeout.tv_nsec = static_cast<long>(remainingNs % 1000000000);
+        numWaiters.fetch_add(1);
+        FutexWait(&sequence, consumed, &timeout);
+        numWaiters.fetch_sub(1);
+    }
+    return true;
+    #endif
+}
+
+void WakeupSignal::Clear(void){
+    #ifdef _WIN32
+    std::unique_lock<std::mutex> lock(mtx);
+    #endif
+    consumed = sequence.load();
+}
+
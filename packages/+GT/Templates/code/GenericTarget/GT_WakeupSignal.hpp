@@ -0,0 +1,75 @@
+#pragma once
+
+
+#include <GenericTarget/GT_Common.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief The wakeup signal is a lock-free notification primitive for exactly one waiting thread. It consists of an atomic sequence counter that
+ * is incremented by @ref Notify. The waiting thread blocks until the sequence counter differs from the last value it has consumed. On linux, blocking
+ * and waking is done directly via the futex system call, the notifying thread never takes a lock and only enters the kernel if a thread is waiting.
+ * On windows, a mutex and a condition variable are used instead.
+ * @details Several notifications that happen before the waiting thread consumes them are collapsed into a single wakeup.
+ */
+class WakeupSignal {
+    public:
+        /**
+         * @brief Create a new wakeup signal.
+         */
+        WakeupSignal();
+
+        /**
+         * @brief Notify the waiting thread. If no thread is waiting, the next call to @ref Wait or @ref WaitFor returns immediately.
+         * @details This function is lock-free on linux and can be called from any thread.
+         */
+        void Notify(void);
+
+        /**
+         * @brief Wait until a notification has been received that has not been consumed yet.
+         * @details Only one thread is allowed to wait for a wakeup signal.
+         */
+        void Wait(void);
+
+        /**
+         * @brief Wait until a notification has been received that has not been consumed yet or until a timeout occurred.
+         * @param [in] timeoutMs Timeout in milliseconds.
+         * @return True if a notification has been consumed, false in case of timeout.
+         * @details Only one thread is allowed to wait for a wakeup signal.
+         */
+        bool WaitFor(uint32_t timeoutMs);
+
+        /**
+         * @brief Clear all notifications that have not been consumed yet.
+         * @details This function must not be called while another thread is waiting for this wakeup signal.
+         */
+        void Clear(void);
+
+    private:
+        std::atomic<uint32_t> sequence;     ///< Sequence counter that is incremented with each notification. On linux, this is the futex word.
+        std::atomic<uint32_t> numWaiters;   ///< Number of threads that are currently blocked (zero or one). It's used to skip the wake system call if nobody waits.
+        uint32_t consumed;                  ///< The latest sequence counter value that has been consumed by the waiting thread.
+        #ifdef _WIN32
+        std::mutex mtx;                     ///< [Windows] Mutex for thread notification.
+        std::condition_variable cv;         ///< [Windows] Condition variable for thread notification.
+        #endif
+
+        /**
+         * @brief Check for a notification that has not been consumed yet and consume it.
+         * @return True if a notification has been consumed, false otherwise.
+         */
+        inline bool TryConsume(void){
+            uint32_t s = sequence.load(std::memory_order_acquire);
+            if(s != consumed){
+                consumed = s;
+                return true;
+            }
+            return false;
+        }
+};
+
+
+} /* namespace: gt */
+
@@ -0,0 +1,141 @@
+#include <GenericTarget/GT_Watchdog.hpp>
+#include <GenericTarget/GT_GenericTarget.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
+using namespace gt;
+
+
+std::atomic<int> Watchdog::numFrames = 0;
+void* Watchdog::frames[GENERIC_TARGET_WATCHDOG_BACKTRACE_SIZE];
+
+
+Watchdog::Watchdog(){
+    terminate = false;
+    numHungSteps = 0;
+}
+
+Watchdog::~Watchdog(){
+    Stop();
+}
+
+void Watchdog::Start(const std::vector<PeriodicTask*>& tasks){
+    Stop();
+    numHungSteps = 0;
+    if(SimulinkInterface::watchdogTimeoutFactor <= 0.0){
+        return;
+    }
+    this->tasks = tasks;
+    reportedSteps.assign(tasks.size(), 0);
+    #ifndef _WIN32
+    // The first call of backtrace loads the unwinder and may allocate memory, which is not allowed inside the signal handler
+    (void) backtrace(&frames[0], GENERIC_TARGET_WATCHDOG_BACKTRACE_SIZE);
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = &Watchdog::BacktraceSignalHandler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if(0 != sigaction(GENERIC_TARGET_SIGNAL_WATCHDOG, &action, nullptr)){
+        GENERIC_TARGET_PRINT_WARNING("Could not set the signal handler for the watchdog: backtraces of hung steps are not available!\n");
+    }
+    #endif
+    {
+        const std::lock_guard<std::mutex> lock(mtx);
+        terminate = false;
+    }
+
+    // The watchdog keeps the default (non-realtime) priority: the runtime of realtime threads is throttled by the kernel, such that the watchdog still runs if a realtime thread is stuck on the same CPU core
+    thread = std::thread(&Watchdog::WatchdogThread, this);
+}
+
+void Watchdog::Stop(void){
+    {
+        const std::lock_guard<std::mutex> lock(mtx);
+        terminate = true;
+    }
+    cv.notify_all();
+    if(thread.joinable()){
+        thread.join();
+        GENERIC_TARGET_PRINT("Watchdog has been stopped (%lu hung steps)\n", numHungSteps.load());
+    }
+    tasks.clear();
+    reportedSteps.clear();
+}
+
+void Watchdog::WatchdogThread(void){
+    GENERIC_TARGET_PRINT("Watchdog started (timeoutFactor=%lf, terminate=%s)\n", SimulinkInterface::watchdogTimeoutFactor, SimulinkInterface::watchdogTerminate ? "true" : "false");
+    std::unique_lock<std::mutex> lock(mtx);
+    while(!terminate){
+        cv.wait_for(lock, std::chrono::milliseconds(GENERIC_TARGET_WATCHDOG_INTERVAL_MS));
+        if(terminate){
+            break;
+        }
+        int64_t timeNowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        for(auto&& task : tasks){
+            CheckTask(task, timeNowNs);
+        }
+    }
+}
+
+void Watchdog::CheckTask(PeriodicTask* task, int64_t timeNowNs){
+    int64_t timeOfStepStart = task->GetTimeOfStepStart();
+    if(!timeOfStepStart || (reportedSteps[task->taskID] == timeOfStepStart)){
+        return;
+    }
+    const double sampletime = SimulinkInterface::baseSampleTime * double(SimulinkInterface::sampleTicks[task->taskID]);
+    const double runningTime = 1e-9 * double(timeNowNs - timeOfStepStart);
+    if(runningTime <= (SimulinkInterface::watchdogTimeoutFactor * sampletime)){
+        return;
+    }
+    reportedSteps[task->taskID] = timeOfStepStart;
+    uint64_t n = ++numHungSteps;
+    GENERIC_TARGET_PRINT_ERROR("Watchdog: step of task \"%s\" (sampletime=%lf) is running for %lf s (hung steps=%lu)\n", SimulinkInterface::taskNames[task->taskID], sampletime, runningTime, n);
+    PrintBacktrace(task, timeOfStepStart);
+    if(SimulinkInterface::watchdogTerminate){
+        GenericTarget::ShouldTerminate();
+    }
+}
+
+void Watchdog::PrintBacktrace(PeriodicTask* task, int64_t timeOfStepStart){
+    #ifdef _WIN32
+    (void) task;
+    (void) timeOfStepStart;
+    #else
+    // Interrupt the stuck thread: the signal handler writes the backtrace and returns immediately
+    numFrames = -1;
+    if(0 != pthread_kill(task->GetThreadOfStep(), GENERIC_TARGET_SIGNAL_WATCHDOG)){
+        GENERIC_TARGET_PRINT_WARNING("Could not send a signal to the thread of task \"%s\"!\n", SimulinkInterface::taskNames[task->taskID]);
+        return;
+    }
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::milliseconds(GENERIC_TARGET_WATCHDOG_BACKTRACE_TIMEOUT_MS);
+    while((numFrames < 0) && (std::chrono::steady_clock::now() < timeout)){
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    int size = numFrames;
+    if(size < 0){
+        GENERIC_TARGET_PRINT_WARNING("No backtrace received from the thread of task \"%s\"!\n", SimulinkInterface::taskNames[task->taskID]);
+        return;
+    }
+
+    // The backtrace belongs to another thread, if the step has finished in the meantime
+    if(timeOfStepStart != task->GetTimeOfStepStart()){
+        GENERIC_TARGET_PRINT("Step of task \"%s\" has finished before the backtrace has been taken\n", SimulinkInterface::taskNames[task->taskID]);
+        return;
+    }
+    char** messages(backtrace_symbols(&frames[0], size));
+    GENERIC_TARGET_PRINT_RAW("\nBacktrace of task \"%s\":\n", SimulinkInterface::taskNames[task->taskID]);
+    for(int i = 0; (i < size) && (messages != nullptr); ++i){
+        GENERIC_TARGET_PRINT_RAW("[%d]: %s\n", i, messages[i]);
+    }
+    GENERIC_TARGET_PRINT_RAW("\nIf DEBUG mode was enabled for the exectuable, convert a printed address to a corresponding code line by executing the command \"addr2line -e ./GenericTarget +0xABCDEF\" in the binary directory of the application, where 0xABCDEF is the printed address.\n\n");
+    free(messages);
+    #endif
+}
+
+void Watchdog::BacktraceSignalHandler(int signum){
+    (void) signum;
+    #ifndef _WIN32
+    int errnoSaved = errno;
+    numFrames = backtrace(&frames[0], GENERIC_TARGET_WATCHDOG_BACKTRACE_SIZE);
+    errno = errnoSaved;
+    #endif
+}
+
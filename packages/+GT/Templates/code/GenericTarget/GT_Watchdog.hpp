@@ -0,0 +1,87 @@
+#pragma once
+
+
+#include <GenericTarget/GT_PeriodicTask.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief The watchdog monitors the step functions of all periodic tasks. If a step runs longer than a multiple of the sampletime of its
+ * task, e.g. because the model is stuck in a long loop, the watchdog samples the stack of the thread that executes the step and prints
+ * the backtrace to the protocol file. The stack is sampled by sending a signal to the stuck thread, whose handler only calls backtrace.
+ * Each hung step is reported once. Optionally, the application is terminated.
+ */
+class Watchdog {
+    public:
+        /**
+         * @brief Create the watchdog.
+         */
+        Watchdog();
+
+        /**
+         * @brief Stop the watchdog.
+         */
+        ~Watchdog();
+
+        /**
+         * @brief Start the watchdog thread.
+         * @param [in] tasks All periodic tasks to be monitored. The tasks must not be deleted before @ref Stop is called.
+         * @details The watchdog is not started if the watchdog timeout factor is not positive.
+         */
+        void Start(const std::vector<PeriodicTask*>& tasks);
+
+        /**
+         * @brief Stop the watchdog thread.
+         */
+        void Stop(void);
+
+        /**
+         * @brief Get the number of hung steps that have been detected since @ref Start.
+         * @return Number of hung steps.
+         */
+        inline uint64_t GetNumHungSteps(void){ return numHungSteps; }
+
+    private:
+        std::thread thread;                         ///< The watchdog thread.
+        std::mutex mtx;                             ///< Mutex for the condition variable.
+        std::condition_variable cv;                 ///< Wakes up the watchdog thread if it should be terminated.
+        bool terminate;                             ///< True if the watchdog thread should be terminated (protected by @ref mtx).
+        std::vector<PeriodicTask*> tasks;           ///< All monitored tasks.
+        std::vector<int64_t> reportedSteps;         ///< Start times of the steps that have already been reported (one for each task).
+        std::atomic<uint64_t> numHungSteps;         ///< Number of hung steps that have been detected.
+
+        static std::atomic<int> numFrames;          ///< Number of frames written by the signal handler or a negative value if the backtrace is pending.
+        static void* frames[GENERIC_TARGET_WATCHDOG_BACKTRACE_SIZE];   ///< Return addresses written by the signal handler.
+
+        /**
+         * @brief The watchdog thread function.
+         */
+        void WatchdogThread(void);
+
+        /**
+         * @brief Check a task and report a hung step.
+         * @param [in] task The task to be checked.
+         * @param [in] timeNowNs The current steady clock time in nanoseconds.
+         */
+        void CheckTask(PeriodicTask* task, int64_t timeNowNs);
+
+        /**
+         * @brief Print the backtrace of the thread that executes the step of a task.
+         * @param [in] task The task whose step is hung.
+         * @param [in] timeOfStepStart The start time of the hung step.
+         */
+        void PrintBacktrace(PeriodicTask* task, int64_t timeOfStepStart);
+
+        /**
+         * @brief The signal handler that writes the backtrace of the interrupted thread to @ref frames.
+         * @param [in] signum Signal that was received.
+         * @details This function is async-signal-safe, as long as backtrace has been called once before (which loads the unwinder).
+         */
+        static void BacktraceSignalHandler(int signum);
+};
+
+
+} /* namespace: gt */
+
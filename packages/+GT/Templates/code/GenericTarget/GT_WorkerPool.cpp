@@ -0,0 +1,179 @@
+#include <GenericTarget/GT_WorkerPool.hpp>
+#include <GenericTarget/GT_Trace.hpp>
+#include <GenericTarget/GT_GenericTarget.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
+using namespace gt;
+
+
+WorkerPool::WorkerPool(){
+    terminate = false;
+}
+
+WorkerPool::~WorkerPool(){
+    Stop();
+}
+
+void WorkerPool::Start(uint32_t numWorkers){
+    // Make sure that the worker pool is stopped
+    Stop();
+    if(!numWorkers){
+        return;
+    }
+
+    // Workers run with the highest priority of all tasks, the order of steps is given by the priority of the ready tasks
+    int priority = 0;
+    for(uint32_t id = 0; id < SIMULINK_INTERFACE_NUM_TIMINGS; ++id){
+        priority = std::max(priority, SimulinkInterface::priorities[id]);
+    }
+
+    // Create all workers before any thread is started, such that workers can steal from each other
+    terminate = false;
+    for(uint32_t k = 0; k < numWorkers; ++k){
+        Worker* worker = new Worker();
+        worker->ready.reserve(SIMULINK_INTERFACE_NUM_TIMINGS);
+        worker->busy = false;
+        worker->busyTimeNs = 0;
+        worker->numStolen = 0;
+        workers.push_back(worker);
+    }
+    timeOfStart = std::chrono::steady_clock::now();
+
+    // Start worker threads, worker k is pinned to the k-th CPU core of the worker pool bitmask
+    uint64_t cpuMask = SimulinkInterface::cpuAffinityWorkerPool;
+    int numCores = std::popcount(cpuMask);
+    for(uint32_t k = 0; k < numWorkers; ++k){
+        uint64_t workerMask = 0;
+        for(int n = 0, i = 0; numCores && (n < 64); ++n){
+            if((cpuMask & (uint64_t(1) << n)) && ((i++) == int(k % uint32_t(numCores)))){
+                workerMask = uint64_t(1) << n;
+                break;
+            }
+        }
+        if(!workers[k]->thread.Start([this, k](){ WorkerThread(k); }, std::string("gt-worker-") + std::to_string(k), priority, workerMask)){
+            GENERIC_TARGET_PRINT_ERROR("Could not start worker %u\n", k);
+            GenericTarget::ShouldTerminate();
+        }
+    }
+    GENERIC_TARGET_PRINT("Worker pool started (workers=%u, priority=%d)\n", numWorkers, priority);
+}
+
+void WorkerPool::Stop(void){
+    if(workers.empty()){
+        return;
+    }
+
+    // Stop all worker threads, steps that are currently running are finished
+    terminate = true;
+    for(auto&& worker : workers){
+        worker->wakeupSignal.Notify();
+    }
+    for(auto&& worker : workers){
+        worker->thread.Join();
+    }
+
+    // Print utilization and delete workers
+    GENERIC_TARGET_PRINT("Worker pool has been stopped\n");
+    for(uint32_t k = 0; k < (uint32_t)workers.size(); ++k){
+        GENERIC_TARGET_PRINT("  worker %u: utilization=%.2lf %%, stolen=%lu\n", k, 100.0 * GetUtilization(k), uint64_t(workers[k]->numStolen));
+    }
+    for(auto&& worker : workers){
+        delete worker;
+    }
+    workers.clear();
+    terminate = false;
+}
+
+void WorkerPool::Submit(PeriodicTask* task){
+    // A task is queued at most once, the worker that runs the task also runs all activations that arrive in the meantime
+    if(workers.empty() || task->scheduled.exchange(true)){
+        return;
+    }
+    Worker& home = *workers[task->taskID % (uint32_t)workers.size()];
+    Push(home, task);
+    home.wakeupSignal.Notify();
+
+    // Wake up an idle worker to steal the task if the home worker is busy
+    if(home.busy){
+        for(auto&& worker : workers){
+            if(!worker->busy){
+                worker->wakeupSignal.Notify();
+                break;
+            }
+        }
+    }
+}
+
+double WorkerPool::GetUtilization(const uint32_t workerID){
+    if(workerID >= (uint32_t)workers.size()){
+        return -1.0;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - timeOfStart).count();
+    return (elapsed > 0) ? (double(workers[workerID]->busyTimeNs) / double(elapsed)) : 0.0;
+}
+
+void WorkerPool::WorkerThread(uint32_t workerID){
+    Worker& self = *workers[workerID];
+    Trace::RegisterThread("worker " + std::to_string(workerID));
+    for(;;){
+        // Wait for notification
+        self.wakeupSignal.Wait();
+
+        // Run own ready tasks first, then steal ready tasks from other workers
+        while(!terminate){
+            PeriodicTask* task = Pop(self);
+            if(!task){
+                task = Steal(workerID);
+                if(!task){
+                    break;
+                }
+                ++self.numStolen;
+            }
+            self.busy = true;
+            auto t1 = std::chrono::steady_clock::now();
+            task->RunPendingActivations(task->timeOfNotify);
+            auto t2 = std::chrono::steady_clock::now();
+            self.busyTimeNs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+
+            // The task may have been activated again while it was running: queue it again, otherwise that activation would be lost
+            task->scheduled = false;
+            if(task->pendingActivations && !task->scheduled.exchange(true)){
+                Push(self, task);
+            }
+        }
+        self.busy = false;
+
+        // Check termination flag
+        if(terminate){
+            break;
+        }
+    }
+    Trace::UnregisterThread();
+}
+
+void WorkerPool::Push(Worker& worker, PeriodicTask* task){
+    const std::lock_guard<std::mutex> lock(worker.mtxReady);
+    worker.ready.push_back(task);
+}
+
+PeriodicTask* WorkerPool::Pop(Worker& worker){
+    const std::lock_guard<std::mutex> lock(worker.mtxReady);
+    if(worker.ready.empty()){
+        return nullptr;
+    }
+    auto it = std::max_element(worker.ready.begin(), worker.ready.end(), [](const PeriodicTask* a, const PeriodicTask* b){ return SimulinkInterface::priorities[a->taskID] < SimulinkInterface::priorities[b->taskID]; });
+    PeriodicTask* task = *it;
+    worker.ready.erase(it);
+    return task;
+}
+
+PeriodicTask* WorkerPool::Steal(uint32_t workerID){
+    uint32_t numWorkers = (uint32_t)workers.size();
+    for(uint32_t k = 1; k < numWorkers; ++k){
+        PeriodicTask* task = Pop(*workers[(workerID + k) % numWorkers]);
+        if(task){
+            return task;
+        }
+    }
+    return nullptr;
+}
+
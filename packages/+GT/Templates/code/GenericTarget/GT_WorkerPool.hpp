@@ -0,0 +1,109 @@
+#pragma once
+
+
+#include <GenericTarget/GT_PeriodicTask.hpp>
+
+
+namespace gt {
+
+
+/**
+ * @brief The worker pool is an optional execution engine for the periodic tasks. Instead of one thread per task, a fixed number of realtime
+ * worker threads executes the due steps of all tasks. Each task has a home worker. Ready tasks are taken by priority and idle workers steal
+ * ready tasks from busy workers. A task is queued at most once and executed by at most one worker at a time, such that all steps of one rate
+ * are executed one after the other in the correct order.
+ */
+class WorkerPool {
+    public:
+        /**
+         * @brief Create a new worker pool.
+         */
+        WorkerPool();
+
+        /**
+         * @brief Destroy the worker pool.
+         */
+        ~WorkerPool();
+
+        /**
+         * @brief Start or restart the worker pool.
+         * @param [in] numWorkers Number of worker threads. If this value is zero, the worker pool is not started.
+         */
+        void Start(uint32_t numWorkers);
+
+        /**
+         * @brief Stop the worker pool and print the utilization of all workers.
+         * @details Steps that are currently running are finished before the workers are stopped.
+         */
+        void Stop(void);
+
+        /**
+         * @brief Submit a task whose pending activations should be executed by the worker pool.
+         * @param [in] task The task to be submitted.
+         * @details If the task is already queued or running, it's not queued again. The worker that runs the task executes all pending activations.
+         */
+        void Submit(PeriodicTask* task);
+
+        /**
+         * @brief Get the number of worker threads.
+         * @return Number of worker threads, zero if the worker pool has not been started.
+         */
+        inline uint32_t GetNumWorkers(void){ return static_cast<uint32_t>(workers.size()); }
+
+        /**
+         * @brief Get the utilization of a worker.
+         * @param [in] workerID The ID of the worker.
+         * @return Ratio of the time the worker executed steps to the elapsed time since @ref Start or a negative value if the workerID is invalid.
+         */
+        double GetUtilization(const uint32_t workerID);
+
+    private:
+        /**
+         * @brief Internal data of one worker thread.
+         */
+        struct Worker {
+            RealTimeThread thread;                      ///< The worker thread.
+            WakeupSignal wakeupSignal;                  ///< Lock-free wakeup signal for thread notification.
+            std::mutex mtxReady;                        ///< Protect the @ref ready container.
+            std::vector<PeriodicTask*> ready;           ///< Ready tasks of this worker (capacity is reserved for all tasks).
+            std::atomic<bool> busy;                     ///< True if the worker is executing steps, false otherwise.
+            std::atomic<uint64_t> busyTimeNs;           ///< Total time in nanoseconds the worker executed steps.
+            std::atomic<uint64_t> numStolen;            ///< Number of tasks this worker has stolen from other workers.
+        };
+
+        std::vector<Worker*> workers;                   ///< All workers of the pool.
+        std::atomic<bool> terminate;                    ///< True if worker threads are to be terminated, false otherwise.
+        std::chrono::time_point<std::chrono::steady_clock> timeOfStart;   ///< Timepoint of @ref Start.
+
+        /**
+         * @brief Internal worker thread function.
+         * @param [in] workerID The ID of the worker.
+         */
+        void WorkerThread(uint32_t workerID);
+
+        /**
+         * @brief Push a task to the ready container of a worker.
+         * @param [in] worker The worker.
+         * @param [in] task The task to be pushed.
+         */
+        void Push(Worker& worker, PeriodicTask* task);
+
+        /**
+         * @brief Remove the ready task with the highest priority from a worker.
+         * @param [in] worker The worker from which to take a ready task.
+         * @return The ready task with the highest priority or nullptr if there's no ready task.
+         */
+        PeriodicTask* Pop(Worker& worker);
+
+        /**
+         * @brief Take the ready task with the highest priority from another worker.
+         * @param [in] workerID The ID of the worker that steals.
+         * @return The stolen task or nullptr if no other worker has a ready task.
+         * @details Other workers are visited in round-robin order, starting with the next worker.
+         */
+        PeriodicTask* Steal(uint32_t workerID);
+};
+
+
+} /* namespace: gt */
+
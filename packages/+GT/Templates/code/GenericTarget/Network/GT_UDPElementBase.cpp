@@ -1,5 +1,6 @@
 #include <GenericTarget/Network/GT_UDPElementBase.hpp>
 #include <GenericTarget/GT_GenericTarget.hpp>
+#include <SimulinkCodeGeneration/SimulinkInterface.hpp>
 using namespace gt;
 
 
@@ -16,9 +17,7 @@ UDPElementBase::~UDPElementBase(){
     udpRetryTimer.NotifyOne(0);
 
     // Wait until worker thread terminates
-    if(workerThread.joinable()){
-        workerThread.join();
-    }
+    workerThread.Join();
 
     // Free memory of receive buffer
     mtxReceiveBuffer.lock();
@@ -62,12 +61,10 @@ void UDPElementBase::Start(void){
     receiveBuffer.AllocateMemory(configuration.rxBufferSize, configuration.numBuffers);
     mtxReceiveBuffer.unlock();
 
-    // Start a worker thread and set its priority
-    workerThread = std::thread(&UDPElementBase::WorkerThread, this, configuration);
-    struct sched_param param;
-    param.sched_priority = configuration.priorityThread;
-    if(0 != pthread_setschedparam(workerThread.native_handle(), SCHED_FIFO, &param)){
-        GENERIC_TARGET_PRINT_WARNING("Could not set thread priority %d!\n", configuration.priorityThread);
+    // Start a worker thread with its priority
+    const UDPConfiguration conf = configuration;
+    if(!workerThread.Start([this, conf](){ WorkerThread(conf); }, "gt-udp-" + std::to_string(port), conf.priorityThread, SimulinkInterface::cpuAffinityNetwork)){
+        GENERIC_TARGET_PRINT_ERROR("Could not start the worker thread for UDP port %u!\n", port);
     }
 }
 
@@ -80,9 +77,7 @@ void UDPElementBase::Stop(void){
     udpRetryTimer.NotifyOne(0);
 
     // Wait until worker thread terminates
-    if(workerThread.joinable()){
-        workerThread.join();
-    }
+    workerThread.Join();
 
     // Reset default values
     terminate = false;
@@ -95,6 +90,7 @@ void UDPElementBase::Stop(void){
 }
 
 std::tuple<int32_t,int32_t> UDPElementBase::Send(const uint16_t* destination, const uint8_t* bytes, const uint32_t length){
+    const TraceScope trace(trace_event::UDP_SEND, port);
     Address address((uint8_t)(0x00FF & destination[0]), (uint8_t)(0x00FF & destination[1]), (uint8_t)(0x00FF & destination[2]), (uint8_t)(0x00FF & destination[3]), destination[4]);
     socket.ResetLastError();
     int32_t tx = socket.SendTo(address, (uint8_t*)bytes, length);
@@ -142,6 +138,7 @@ int32_t UDPElementBase::Receive(uint16_t* sources, uint8_t* bytes, uint32_t* len
 }
 
 void UDPElementBase::WorkerThread(const UDPConfiguration conf){
+    Trace::RegisterThread("udp " + std::to_string(port));
     uint8_t* localBuffer = new uint8_t[conf.rxBufferSize]; // local buffer where to store received messages
     while(!terminate){
         // Initialize the socket operation
@@ -172,6 +169,7 @@ void UDPElementBase::WorkerThread(const UDPConfiguration conf){
             }
 
             // Copy received message to UDP buffer (thread-safe)
+            Trace::Event(trace_event::UDP_RECEIVE, trace_phase::INSTANT, static_cast<uint32_t>(rx));
             CopyMessageToBuffer(&localBuffer[0], static_cast<uint32_t>(rx), source, timestamp, conf);
         }
 
@@ -179,6 +177,7 @@ void UDPElementBase::WorkerThread(const UDPConfiguration conf){
         TerminateSocket(conf, true);
     }
     delete[] localBuffer;
+    Trace::UnregisterThread();
 }
 
 void UDPElementBase::CopyMessageToBuffer(uint8_t* messageBytes, uint32_t messageLength, const Address source, const double timestamp, const UDPConfiguration conf){
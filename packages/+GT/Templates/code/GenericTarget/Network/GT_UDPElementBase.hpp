@@ -5,6 +5,7 @@
 #include <GenericTarget/Network/GT_UDPReceiveBuffer.hpp>
 #include <GenericTarget/Network/GT_UDPSocket.hpp>
 #include <GenericTarget/GT_Event.hpp>
+#include <GenericTarget/GT_RealTimeThread.hpp>
 
 
 namespace gt {
@@ -116,7 +117,7 @@ class UDPElementBase {
         std::mutex mtxReceiveBuffer;      ///< Protect the @ref receiveBuffer.
         std::atomic<bool> terminate;      ///< Termination flag that indicates whether the worker thread should be terminated or not.
         Event udpRetryTimer;              ///< A timer to wait before retrying to initialize a UDP socket in case of errors.
-        std::thread workerThread;         ///< Worker thread instance for the whole UDP operation.
+        RealTimeThread workerThread;      ///< Worker thread instance for the whole UDP operation.
 
         /**
          * @brief The worker thread for the whole UDP operation.
@@ -8,11 +8,14 @@ UDPUnicastManager::UDPUnicastManager(){
 }
 
 void UDPUnicastManager::RegisterSender(const uint16_t port, const UDPConfiguration& senderConfiguration){
-    // Print warning if UDP sockets have already been created
+    // Print warning if UDP sockets have already been created (known sockets are registered again if the model is restarted)
     mtx.lock();
     if(created){
+        bool known = (elements.find(port) != elements.end());
         mtx.unlock();
-        GENERIC_TARGET_PRINT_WARNING("Cannot register UDP socket (port=%d) because socket creation was already done!\n", port);
+        if(!known){
+            GENERIC_TARGET_PRINT_WARNING("Cannot register UDP socket (port=%d) because socket creation was already done!\n", port);
+        }
         return;
     }
 
@@ -36,11 +39,14 @@ void UDPUnicastManager::RegisterSender(const uint16_t port, const UDPConfigurati
 }
 
 void UDPUnicastManager::RegisterReceiver(const uint16_t port, const UDPConfiguration& receiverConfiguration){
-    // Print warning if UDP sockets have already been created
+    // Print warning if UDP sockets have already been created (known sockets are registered again if the model is restarted)
     mtx.lock();
     if(created){
+        bool known = (elements.find(port) != elements.end());
         mtx.unlock();
-        GENERIC_TARGET_PRINT_WARNING("Cannot register UDP socket (port=%d) because socket creation was already done!\n", port);
+        if(!known){
+            GENERIC_TARGET_PRINT_WARNING("Cannot register UDP socket (port=%d) because socket creation was already done!\n", port);
+        }
         return;
     }
 